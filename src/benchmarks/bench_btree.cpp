@@ -0,0 +1,52 @@
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "bench_entry.h"
+
+// Случайный поиск по целочисленному индексу: s21::map (AVL, узел на ключ) против s21::btree_map (много ключей в узле).
+// Размеры идут по очереди, чтобы одновременно в памяти был только один индекс.
+
+namespace {
+    const size_t kLookups = 1000000;
+
+    template<typename Map>
+    void RunLookups(const char *name, size_t count, Map &map, const std::vector<int> &queries) {
+        size_t checksum = 0;
+        double ms = bench::MeasureMs([&] {
+            for (int key : queries) {
+                checksum += static_cast<size_t>(map.find(key)->second);
+            }
+        });
+        bench::DoNotOptimize(checksum);
+        std::string label = std::string(name) + ", " + std::to_string(count) + " keys, find";
+        bench::Report(label.c_str(), queries.size(), ms);
+    }
+
+    void RunSize(size_t count) {
+        std::vector<int> queries(kLookups);
+        std::mt19937 gen(15);
+        std::uniform_int_distribution<int> dist(0, static_cast<int>(count) - 1);
+        for (auto &key : queries) key = dist(gen);
+        {
+            std::vector<std::pair<int, int>> rows(count);
+            for (size_t i = 0; i < count; ++i) rows[i] = {static_cast<int>(i), static_cast<int>(i)};
+            s21::map<int, int> map(rows.begin(), rows.end());
+            rows = std::vector<std::pair<int, int>>();
+            RunLookups("map<int, int>", count, map, queries);
+        }
+        {
+            s21::btree_map<int, int> map;
+            for (size_t i = 0; i < count; ++i) map.insert(static_cast<int>(i), static_cast<int>(i));
+            RunLookups("btree_map<int, int>", count, map, queries);
+        }
+    }
+} // namespace
+
+int main() {
+    for (size_t count : {size_t(1000), size_t(1000000), size_t(50000000)}) {
+        RunSize(count);
+    }
+    return 0;
+}
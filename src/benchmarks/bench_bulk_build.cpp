@@ -0,0 +1,44 @@
+#include <algorithm>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "bench_entry.h"
+
+// Загрузка отсортированного снимка в s21::map: вставка по одному элементу против построения снизу вверх.
+
+int main() {
+    const size_t count = 2000000;
+    std::vector<std::pair<int, int>> rows(count);
+    for (size_t i = 0; i < count; ++i) rows[i] = {static_cast<int>(i), static_cast<int>(i)};
+    std::vector<std::pair<int, int>> shuffled = rows;
+    std::shuffle(shuffled.begin(), shuffled.end(), std::mt19937(21));
+
+    double ms = bench::MeasureMs([&] {
+        s21::map<int, int> map;
+        for (const auto &row : rows) map.insert(row);
+        bench::DoNotOptimize(map);
+    });
+    bench::Report("sorted rows, insert one by one", count, ms);
+
+    ms = bench::MeasureMs([&] {
+        s21::map<int, int> map(rows.begin(), rows.end());
+        bench::DoNotOptimize(map);
+    });
+    bench::Report("sorted rows, range constructor", count, ms);
+
+    ms = bench::MeasureMs([&] {
+        s21::map<int, int> map;
+        for (const auto &row : shuffled) map.insert(row);
+        bench::DoNotOptimize(map);
+    });
+    bench::Report("shuffled rows, insert one by one", count, ms);
+
+    ms = bench::MeasureMs([&] {
+        s21::map<int, int> map;
+        map.assign_sorted(shuffled.begin(), shuffled.end());
+        bench::DoNotOptimize(map);
+    });
+    bench::Report("shuffled rows, assign_sorted (sort fallback)", count, ms);
+    return 0;
+}
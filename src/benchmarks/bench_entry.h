@@ -0,0 +1,34 @@
+#ifndef SRC_BENCH_ENTRY_H
+#define SRC_BENCH_ENTRY_H
+
+#include <chrono>
+#include <cstdio>
+
+#include "../s21_containers.h"
+#include "../s21_containersplus.h"
+
+// Общие функции для бенчмарков: каждый бенчмарк - отдельная программа с main(), запускается через make bench
+
+namespace bench {
+    // runs fn once and returns the elapsed wall time in milliseconds
+    template<typename Fn>
+    double MeasureMs(Fn &&fn) {
+        auto start = std::chrono::steady_clock::now();
+        fn();
+        auto finish = std::chrono::steady_clock::now();
+        return std::chrono::duration<double, std::milli>(finish - start).count();
+    }
+
+    // prints one result line: name, number of operations, total time and time per operation
+    inline void Report(const char *name, size_t ops, double ms) {
+        std::printf("%-48s %10zu ops %10.2f ms %9.1f ns/op\n", name, ops, ms, ms * 1e6 / static_cast<double>(ops));
+    }
+
+    // keeps the compiler from optimizing the computation of value away
+    template<typename T>
+    void DoNotOptimize(const T &value) {
+        asm volatile("" : : "r"(&value) : "memory");
+    }
+} // namespace bench
+
+#endif //SRC_BENCH_ENTRY_H
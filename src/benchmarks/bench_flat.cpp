@@ -0,0 +1,54 @@
+#include <algorithm>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "bench_entry.h"
+
+// Индекс, который строится один раз и потом только читается: s21::map против s21::flat_map.
+// Меряются построение из перемешанных пар, случайный поиск и полный обход.
+
+namespace {
+    template<typename Map>
+    void Run(const char *name, const std::vector<std::pair<int, int>> &rows, const std::vector<int> &queries) {
+        Map *map = nullptr;
+        double ms = bench::MeasureMs([&] { map = new Map(rows.begin(), rows.end()); });
+        std::string label = std::string(name) + ", build from shuffled range";
+        bench::Report(label.c_str(), rows.size(), ms);
+
+        size_t checksum = 0;
+        ms = bench::MeasureMs([&] {
+            for (int key : queries) {
+                checksum += static_cast<size_t>(map->find(key)->second);
+            }
+        });
+        label = std::string(name) + ", random find";
+        bench::Report(label.c_str(), queries.size(), ms);
+
+        ms = bench::MeasureMs([&] {
+            for (auto it = map->begin(); it != map->end(); ++it) {
+                checksum += static_cast<size_t>(it->second);
+            }
+        });
+        bench::DoNotOptimize(checksum);
+        label = std::string(name) + ", full scan";
+        bench::Report(label.c_str(), rows.size(), ms);
+        delete map;
+    }
+} // namespace
+
+int main() {
+    const size_t count = 1000000;
+    std::vector<std::pair<int, int>> rows(count);
+    for (size_t i = 0; i < count; ++i) rows[i] = {static_cast<int>(i), static_cast<int>(i)};
+    std::mt19937 gen(16);
+    std::shuffle(rows.begin(), rows.end(), gen);
+    std::vector<int> queries(count);
+    std::uniform_int_distribution<int> dist(0, static_cast<int>(count) - 1);
+    for (auto &key : queries) key = dist(gen);
+
+    Run<s21::map<int, int>>("map<int, int>", rows, queries);
+    Run<s21::flat_map<int, int>>("flat_map<int, int>", rows, queries);
+    return 0;
+}
@@ -0,0 +1,108 @@
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include "bench_entry.h"
+
+// Точечный поиск среди 10M ключей: s21::set (узлы дерева и указатели), flat_set (бинарный поиск по массиву)
+// и frozen_set (раскладка Эйтцингера с подгрузкой следующих уровней). Кроме времени печатается число промахов
+// последнего уровня кэша на один поиск - его считает счетчик процессора через perf_event_open (только Linux;
+// если счетчик недоступен, например в виртуальной машине, вместо числа печатается n/a).
+
+namespace {
+    // counts the last level cache misses of this thread between Start() and Stop()
+    class CacheMissCounter {
+    public:
+        CacheMissCounter() {
+#ifdef __linux__
+            perf_event_attr attr{};
+            attr.type = PERF_TYPE_HARDWARE;
+            attr.size = sizeof(attr);
+            attr.config = PERF_COUNT_HW_CACHE_MISSES;
+            attr.disabled = 1;
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+            fd_ = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+#endif
+        };
+        ~CacheMissCounter() {
+#ifdef __linux__
+            if (fd_ >= 0) close(fd_);
+#endif
+        };
+
+        bool Available() const { return fd_ >= 0; };
+        void Start() {
+#ifdef __linux__
+            if (fd_ < 0) return;
+            ioctl(fd_, PERF_EVENT_IOC_RESET, 0);
+            ioctl(fd_, PERF_EVENT_IOC_ENABLE, 0);
+#endif
+        };
+        long long Stop() {
+            long long count = 0;
+#ifdef __linux__
+            if (fd_ < 0) return 0;
+            ioctl(fd_, PERF_EVENT_IOC_DISABLE, 0);
+            if (read(fd_, &count, sizeof(count)) != sizeof(count)) count = 0;
+#endif
+            return count;
+        };
+
+    private:
+        int fd_ = -1;
+    };
+
+    template<typename Find>
+    void Run(const char *name, const std::vector<uint64_t> &lookups, Find find) {
+        CacheMissCounter misses;
+        uint64_t found = 0;
+        misses.Start();
+        double ms = bench::MeasureMs([&] {
+            for (uint64_t key : lookups) found += find(key);
+        });
+        long long count = misses.Stop();
+        bench::DoNotOptimize(found);
+        bench::Report(name, lookups.size(), ms);
+        if (misses.Available()) {
+            std::printf("%-48s %10.2f cache misses per lookup\n", "",
+                        static_cast<double>(count) / static_cast<double>(lookups.size()));
+        } else {
+            std::printf("%-48s %10s cache misses per lookup\n", "", "n/a");
+        }
+    }
+} // namespace
+
+int main() {
+    const size_t count = 10000000;
+    std::mt19937_64 gen(25);
+    std::vector<uint64_t> keys(count);
+    for (auto &key : keys) key = gen();
+    std::sort(keys.begin(), keys.end());
+    keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+
+    std::vector<uint64_t> lookups(2000000);
+    for (auto &key : lookups) key = keys[gen() % keys.size()];
+
+    s21::set<uint64_t> tree(keys.begin(), keys.end());
+    Run("set<u64> find", lookups, [&](uint64_t key) { return tree.find(key) != tree.end(); });
+
+    s21::frozen_set<uint64_t> frozen;
+    double ms = bench::MeasureMs([&] { frozen = tree.freeze(); });
+    bench::Report("set<u64> freeze", keys.size(), ms);
+    tree.clear();
+
+    s21::flat_set<uint64_t> flat(keys.begin(), keys.end());
+    Run("flat_set<u64> find", lookups, [&](uint64_t key) { return flat.find(key) != flat.end(); });
+    Run("frozen_set<u64> find", lookups, [&](uint64_t key) { return frozen.contains(key); });
+    return 0;
+}
@@ -0,0 +1,60 @@
+#include <random>
+#include <vector>
+
+#include "bench_entry.h"
+
+// Сколько сравнений ключей и времени уходит на одну вставку в s21::map
+// через insert, operator[] и insert_or_assign.
+
+namespace {
+    // int key that counts how many times it was compared
+    struct CountedKey {
+        int value;
+        static size_t comparisons;
+
+        bool operator<(const CountedKey &other) const {
+            ++comparisons;
+            return value < other.value;
+        }
+        bool operator>(const CountedKey &other) const { return other < *this; }
+        bool operator==(const CountedKey &other) const {
+            ++comparisons;
+            return value == other.value;
+        }
+    };
+    size_t CountedKey::comparisons = 0;
+
+    template<typename Fn>
+    void Run(const char *name, size_t ops, Fn &&fn) {
+        CountedKey::comparisons = 0;
+        double ms = bench::MeasureMs(fn);
+        bench::Report(name, ops, ms);
+        std::printf("%-48s %10.1f comparisons/op\n", "",
+                    static_cast<double>(CountedKey::comparisons) / static_cast<double>(ops));
+    }
+} // namespace
+
+int main() {
+    const size_t count = 500000;
+    std::mt19937 gen(6);
+    std::vector<CountedKey> keys(count);
+    for (size_t i = 0; i < count; ++i) keys[i].value = static_cast<int>(gen() % (count * 4));
+
+    s21::map<CountedKey, int> by_insert;
+    Run("map insert(key, value)", count, [&] {
+        for (const CountedKey &key : keys) by_insert.insert(key, 1);
+    });
+
+    s21::map<CountedKey, int> by_subscript;
+    Run("map operator[] (new and existing keys)", 2 * count, [&] {
+        for (const CountedKey &key : keys) by_subscript[key] += 1;
+        for (const CountedKey &key : keys) by_subscript[key] += 1;
+    });
+
+    Run("map insert_or_assign (existing keys)", count, [&] {
+        for (const CountedKey &key : keys) by_insert.insert_or_assign(key, 2);
+    });
+    bench::DoNotOptimize(by_insert);
+    bench::DoNotOptimize(by_subscript);
+    return 0;
+}
@@ -0,0 +1,56 @@
+#include <algorithm>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "bench_entry.h"
+
+// Вставка потока ключей в map без подсказки и с подсказкой end(). Для отсортированного потока подсказка всегда
+// верна и поиск от корня не нужен, для почти отсортированного (каждый сотый ключ не на месте) она иногда
+// промахивается, для случайного - почти всегда, и тогда вставка стоит столько же, сколько обычная.
+
+namespace {
+    template<typename Map>
+    void Run(const char *name, const char *stream, const std::vector<int> &keys) {
+        size_t checksum = 0;
+        double ms = bench::MeasureMs([&] {
+            Map map;
+            for (int key : keys) map.insert({key, key});
+            checksum += map.size();
+        });
+        std::string label = std::string(name) + ", " + stream + ", insert";
+        bench::Report(label.c_str(), keys.size(), ms);
+
+        ms = bench::MeasureMs([&] {
+            Map map;
+            for (int key : keys) map.insert(map.end(), {key, key});
+            checksum += map.size();
+        });
+        bench::DoNotOptimize(checksum);
+        label = std::string(name) + ", " + stream + ", insert(end())";
+        bench::Report(label.c_str(), keys.size(), ms);
+    }
+
+    void RunAll(const char *stream, const std::vector<int> &keys) {
+        Run<s21::map<int, int>>("map<int, int>", stream, keys);
+        Run<std::map<int, int>>("std::map<int, int>", stream, keys);
+    }
+} // namespace
+
+int main() {
+    const size_t count = 2000000;
+    std::mt19937 gen(22);
+    std::vector<int> keys(count);
+    for (size_t i = 0; i < count; ++i) keys[i] = static_cast<int>(i);
+    RunAll("sorted", keys);
+
+    // каждый сотый ключ меняется местами со случайным ключом неподалеку
+    std::uniform_int_distribution<size_t> near(1, 1000);
+    for (size_t i = 0; i + 1000 < count; i += 100) std::swap(keys[i], keys[i + near(gen)]);
+    RunAll("almost sorted", keys);
+
+    std::shuffle(keys.begin(), keys.end(), gen);
+    RunAll("random", keys);
+    return 0;
+}
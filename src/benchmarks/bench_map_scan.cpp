@@ -0,0 +1,30 @@
+#include <string>
+
+#include "bench_entry.h"
+
+// Полный проход по s21::map с разыменованием итератора на каждом шаге.
+
+int main() {
+    const int count = 1000000;
+    s21::map<int, std::string> small_values;
+    s21::map<int, std::string> large_values;
+    for (int i = 0; i < count; ++i) {
+        small_values.insert(i, "v");
+        large_values.insert(i, std::string(64, 'x'));
+    }
+
+    for (auto *map : {&small_values, &large_values}) {
+        size_t checksum = 0;
+        double ms = bench::MeasureMs([&] {
+            for (int round = 0; round < 5; ++round) {
+                for (auto it = map->begin(); it != map->end(); ++it) {
+                    checksum += static_cast<size_t>((*it).first) + (*it).second.size();
+                }
+            }
+        });
+        bench::DoNotOptimize(checksum);
+        bench::Report(map == &small_values ? "map<int, string(1)> full scan" : "map<int, string(64)> full scan",
+                      5 * static_cast<size_t>(count), ms);
+    }
+    return 0;
+}
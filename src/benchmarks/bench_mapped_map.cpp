@@ -0,0 +1,74 @@
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "bench_entry.h"
+
+// Старт с готовым словарем: разбор текстового дампа в s21::map против открытия двоичного образа через mapped_map.
+// Открытие только отображает файл, поэтому первые поиски идут через миллисекунды; затем сравнивается скорость
+// случайных поисков в map и в mapped_map, полная проверка контрольной суммы и сборка map из образа.
+
+int main() {
+    const size_t count = 10000000;
+    const char path[] = "bench_mapped_map.img";
+    std::mt19937_64 gen(24);
+
+    std::string dump;
+    for (size_t i = 0; i < count; ++i) {
+        dump += std::to_string(i * 3) + ' ' + std::to_string(gen() % 1000000) + '\n';
+    }
+
+    s21::map<uint64_t, uint64_t> map;
+    double ms = bench::MeasureMs([&] {
+        const char *text = dump.c_str();
+        char *end = nullptr;
+        for (size_t i = 0; i < count; ++i) {
+            uint64_t key = std::strtoull(text, &end, 10);
+            uint64_t value = std::strtoull(end, &end, 10);
+            text = end;
+            map.insert(map.end(), {key, value});
+        }
+    });
+    bench::Report("map<u64, u64> from text dump", count, ms);
+
+    ms = bench::MeasureMs([&] { s21::write_image(map, path); });
+    bench::Report("write_image", count, ms);
+
+    s21::mapped_map<uint64_t, uint64_t> view;
+    ms = bench::MeasureMs([&] { view = s21::mapped_map<uint64_t, uint64_t>(path); });
+    bench::Report("mapped_map open", 1, ms);
+
+    std::vector<uint64_t> keys(1000000);
+    for (auto &key : keys) key = (gen() % count) * 3;
+    uint64_t checksum = 0;
+    ms = bench::MeasureMs([&] {
+        for (size_t i = 0; i < 1000; ++i) checksum += view.find(keys[i])->second;
+    });
+    bench::Report("mapped_map first 1000 finds", 1000, ms);
+
+    ms = bench::MeasureMs([&] {
+        for (uint64_t key : keys) checksum += map.find(key)->second;
+    });
+    bench::Report("map find", keys.size(), ms);
+
+    ms = bench::MeasureMs([&] {
+        for (uint64_t key : keys) checksum += view.find(key)->second;
+    });
+    bench::Report("mapped_map find", keys.size(), ms);
+
+    bool valid = false;
+    ms = bench::MeasureMs([&] { valid = view.verify(); });
+    bench::Report(valid ? "mapped_map verify (ok)" : "mapped_map verify (damaged)", count, ms);
+
+    ms = bench::MeasureMs([&] {
+        s21::map<uint64_t, uint64_t> restored(view.begin(), view.end());
+        checksum += restored.size();
+    });
+    bench::Report("map from mapped_map (range constructor)", count, ms);
+    bench::DoNotOptimize(checksum);
+    std::remove(path);
+    return 0;
+}
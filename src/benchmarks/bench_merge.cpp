@@ -0,0 +1,34 @@
+#include "bench_entry.h"
+
+// Слияние s21::map: два больших шарда (половина ключей общая) и маленький шард в большую карту.
+
+namespace {
+    s21::map<int, int> MakeShard(int first, int count, int step) {
+        s21::map<int, int> shard;
+        for (int i = 0; i < count; ++i) shard.insert(first + i * step, i);
+        return shard;
+    }
+} // namespace
+
+int main() {
+    const int rounds = 10;
+    const int count = 200000;
+    double ms = 0;
+    for (int round = 0; round < rounds; ++round) {
+        s21::map<int, int> result = MakeShard(0, count, 2);
+        s21::map<int, int> shard = MakeShard(0, count, 3);
+        ms += bench::MeasureMs([&] { result.merge(shard); });
+        bench::DoNotOptimize(result);
+    }
+    bench::Report("merge 200k + 200k (1/3 shared keys)", rounds * 2 * static_cast<size_t>(count), ms);
+
+    ms = 0;
+    for (int round = 0; round < rounds; ++round) {
+        s21::map<int, int> result = MakeShard(0, 1000000, 1);
+        s21::map<int, int> shard = MakeShard(500000, 1000, 1001);
+        ms += bench::MeasureMs([&] { result.merge(shard); });
+        bench::DoNotOptimize(result);
+    }
+    bench::Report("merge 1k into 1M", rounds * 1000, ms);
+    return 0;
+}
@@ -0,0 +1,54 @@
+#include <random>
+#include <string>
+#include <vector>
+
+#include "bench_entry.h"
+
+// Пропускная способность insert/erase для s21::set и s21::map.
+// make bench собирает этот файл дважды: с пулом узлов и с -DS21_NODE_POOL_DISABLE (new/delete на каждый узел).
+
+#ifdef S21_NODE_POOL_DISABLE
+static const char *kMode = "new/delete";
+#else
+static const char *kMode = "node pool";
+#endif
+
+int main() {
+    const size_t count = 1000000;
+    std::mt19937 gen(21);
+    std::vector<int> keys(count);
+    for (size_t i = 0; i < count; ++i) keys[i] = static_cast<int>(gen());
+
+    std::printf("--- BinaryTree nodes: %s ---\n", kMode);
+    s21::set<int> tree;
+    double ms = bench::MeasureMs([&] {
+        for (int key : keys) tree.insert(key);
+    });
+    bench::Report("set<int> insert random", count, ms);
+
+    // churn: erase one element and insert a new one, the tree size stays the same
+    ms = bench::MeasureMs([&] {
+        for (size_t i = 0; i < count; ++i) {
+            tree.erase(tree.find(keys[i]));
+            keys[i] = static_cast<int>(gen());
+            tree.insert(keys[i]);
+        }
+    });
+    bench::Report("set<int> erase + insert churn", 2 * count, ms);
+
+    ms = bench::MeasureMs([&] { tree.clear(); });
+    bench::Report("set<int> clear", count, ms);
+
+    // build and destroy many small maps, the typical per-request pattern
+    const size_t rounds = 20000;
+    const int per_round = 64;
+    ms = bench::MeasureMs([&] {
+        for (size_t round = 0; round < rounds; ++round) {
+            s21::map<int, std::string> small;
+            for (int i = 0; i < per_round; ++i) small.insert(keys[round + i], "value");
+            bench::DoNotOptimize(small);
+        }
+    });
+    bench::Report("map<int, string> build + destroy x64", rounds * per_round, ms);
+    return 0;
+}
@@ -0,0 +1,52 @@
+#include <random>
+#include <vector>
+
+#include "bench_entry.h"
+
+// Снимок конфигурации из 2M записей: копия s21::map (CopyTree копирует каждый узел) против снимка
+// persistent_map (копия корня), а также цена одного изменения с копированием пути.
+
+int main() {
+    const int count = 2000000;
+    const size_t snapshots = 20;
+    std::vector<std::pair<const int, int>> items;
+    items.reserve(count);
+    for (int i = 0; i < count; ++i) {
+        items.emplace_back(i, i);
+    }
+    s21::map<int, int> map(items.begin(), items.end());
+    s21::persistent_map<int, int> version(items.begin(), items.end());
+
+    double ms = bench::MeasureMs([&] {
+        for (size_t i = 0; i < snapshots; ++i) {
+            s21::map<int, int> copy(map);
+            bench::DoNotOptimize(copy);
+        }
+    });
+    bench::Report("map copy, 2M entries", snapshots, ms);
+
+    ms = bench::MeasureMs([&] {
+        for (size_t i = 0; i < snapshots; ++i) {
+            s21::persistent_map<int, int> snapshot = version.snapshot();
+            bench::DoNotOptimize(snapshot);
+        }
+    });
+    bench::Report("persistent_map snapshot, 2M entries", snapshots, ms);
+
+    const size_t updates = 200000;
+    std::mt19937 gen(19);
+    std::uniform_int_distribution<int> key(0, count - 1);
+    std::vector<int> keys(updates);
+    for (int &k : keys) k = key(gen);
+    ms = bench::MeasureMs([&] {
+        for (int k : keys) version = version.insert_or_assign(k, -k);
+    });
+    bench::Report("persistent_map insert_or_assign (path copy)", updates, ms);
+
+    ms = bench::MeasureMs([&] {
+        for (int k : keys) map[k] = -k;
+    });
+    bench::Report("map operator[] (in place)", updates, ms);
+    bench::DoNotOptimize(version);
+    return 0;
+}
@@ -0,0 +1,38 @@
+#include "bench_entry.h"
+
+// TTL-чистка s21::map: удаление самых старых ключей по одному через find против erase(first, last) и erase_if.
+
+namespace {
+    s21::map<int, int> MakeEvents(int count) {
+        s21::map<int, int> events;
+        for (int t = 0; t < count; ++t) events.insert(t, t);
+        return events;
+    }
+} // namespace
+
+int main() {
+    const int count = 1000000;
+    for (int expired : {1000, 500000}) {
+        s21::map<int, int> events = MakeEvents(count);
+        double ms = bench::MeasureMs([&] {
+            for (int t = 0; t < expired; ++t) events.erase(events.find(t));
+        });
+        char name[96];
+        std::snprintf(name, sizeof(name), "expire %d of %d, erase(find(t))", expired, count);
+        bench::Report(name, static_cast<size_t>(expired), ms);
+
+        events = MakeEvents(count);
+        ms = bench::MeasureMs([&] { events.erase(events.begin(), events.lower_bound(expired)); });
+        std::snprintf(name, sizeof(name), "expire %d of %d, erase(first, last)", expired, count);
+        bench::Report(name, static_cast<size_t>(expired), ms);
+
+        events = MakeEvents(count);
+        ms = bench::MeasureMs([&] {
+            s21::erase_if(events, [expired](const std::pair<const int, int> &entry) { return entry.first < expired; });
+        });
+        std::snprintf(name, sizeof(name), "expire %d of %d, erase_if", expired, count);
+        bench::Report(name, static_cast<size_t>(expired), ms);
+        bench::DoNotOptimize(events);
+    }
+    return 0;
+}
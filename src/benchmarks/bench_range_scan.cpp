@@ -0,0 +1,40 @@
+#include "bench_entry.h"
+
+// Выборка "все события между t1 и t2": линейный проход от begin() против lower_bound/upper_bound.
+// Время поиска границ растет как log n, а сам проход - как k (число элементов в диапазоне).
+
+int main() {
+    const int queries = 200;
+    for (int count : {100000, 1000000}) {
+        s21::map<int, int> events;
+        for (int t = 0; t < count; ++t) events.insert(t, t);
+        for (int width : {10, 1000}) {
+            long long checksum = 0;
+            double ms = bench::MeasureMs([&] {
+                for (int q = 0; q < queries; ++q) {
+                    int from = static_cast<int>((static_cast<long long>(q) * 7919) % (count - width));
+                    for (auto it = events.begin(); it != events.end(); ++it) {
+                        if (it->first >= from + width) break;
+                        if (it->first >= from) checksum += it->second;
+                    }
+                }
+            });
+            char name[96];
+            std::snprintf(name, sizeof(name), "n=%d k=%d linear scan from begin()", count, width);
+            bench::Report(name, queries, ms);
+
+            ms = bench::MeasureMs([&] {
+                for (int q = 0; q < queries; ++q) {
+                    int from = static_cast<int>((static_cast<long long>(q) * 7919) % (count - width));
+                    for (auto it = events.lower_bound(from), end = events.lower_bound(from + width); it != end; ++it) {
+                        checksum += it->second;
+                    }
+                }
+            });
+            std::snprintf(name, sizeof(name), "n=%d k=%d lower_bound range", count, width);
+            bench::Report(name, queries, ms);
+            bench::DoNotOptimize(checksum);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,59 @@
+#include <algorithm>
+#include <iterator>
+#include <random>
+#include <vector>
+
+#include "bench_entry.h"
+
+// Пересечение маленького набора прав пользователя (64 ключа) с большим глобальным набором (2M ключей):
+// s21::set_intersection (поиск от предыдущей позиции) против линейного слияния std::set_intersection
+// по итераторам, затем объединение и разность двух больших наборов через split/join.
+
+int main() {
+    const int global_size = 2000000;
+    const int user_size = 64;
+    const size_t rounds = 20000;
+    std::mt19937 gen(20);
+    std::uniform_int_distribution<int> key(0, 2 * global_size);
+
+    std::vector<int> global_keys(global_size);
+    for (int i = 0; i < global_size; ++i) global_keys[i] = 2 * i;
+    s21::set<int> global(global_keys.begin(), global_keys.end());
+    std::vector<s21::set<int>> users;
+    for (int u = 0; u < 16; ++u) {
+        s21::set<int> user;
+        while (user.size() < static_cast<size_t>(user_size)) user.insert(key(gen));
+        users.push_back(user);
+    }
+
+    size_t checksum = 0;
+    double ms = bench::MeasureMs([&] {
+        for (size_t i = 0; i < rounds; ++i) {
+            checksum += s21::set_intersection(users[i % users.size()], global).size();
+        }
+    });
+    bench::Report("set_intersection 64 x 2M", rounds, ms);
+
+    const size_t linear_rounds = 20;
+    ms = bench::MeasureMs([&] {
+        for (size_t i = 0; i < linear_rounds; ++i) {
+            std::vector<int> common;
+            s21::set<int> &user = users[i % users.size()];
+            std::set_intersection(user.begin(), user.end(), global.begin(), global.end(), std::back_inserter(common));
+            checksum += common.size();
+        }
+    });
+    bench::Report("std::set_intersection over iterators 64 x 2M", linear_rounds, ms);
+
+    std::vector<int> odd_keys(global_size / 2);
+    for (int i = 0; i < global_size / 2; ++i) odd_keys[i] = 4 * i + 1;
+    s21::set<int> odd(odd_keys.begin(), odd_keys.end());
+    s21::set<int> copy = global;
+    ms = bench::MeasureMs([&] { copy = s21::set_union(std::move(copy), std::move(odd)); });
+    bench::Report("set_union 2M + 1M (nodes reused)", copy.size(), ms);
+
+    ms = bench::MeasureMs([&] { copy = s21::set_difference(std::move(copy), users[0]); });
+    bench::Report("set_difference 3M - 64", user_size, ms);
+    bench::DoNotOptimize(checksum);
+    return 0;
+}
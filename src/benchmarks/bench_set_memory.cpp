@@ -0,0 +1,58 @@
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <vector>
+
+#include "bench_entry.h"
+
+// Сколько байт кучи занимает один элемент s21::set / s21::map (узел вместе с данными ключа).
+// Ключи готовятся заранее, а все выделения памяти во время вставки считаются через замену глобального operator new.
+
+namespace {
+    size_t allocated_bytes = 0;
+
+    void *CountedAlloc(size_t size, size_t align) {
+        allocated_bytes += size;
+        void *memory = align > alignof(std::max_align_t) ? std::aligned_alloc(align, (size + align - 1) / align * align)
+                                                          : std::malloc(size);
+        if (memory == nullptr) throw std::bad_alloc();
+        return memory;
+    }
+
+    template<typename Container, typename Fill>
+    void ReportBytesPerElement(const char *name, size_t count, Fill &&fill) {
+        size_t before = allocated_bytes;
+        Container *container = new Container;
+        fill(*container);
+        size_t bytes = allocated_bytes - before;
+        std::printf("%-48s %10zu elements %9.1f bytes/element\n", name, count,
+                    static_cast<double>(bytes) / static_cast<double>(count));
+        delete container;
+    }
+} // namespace
+
+void *operator new(size_t size) { return CountedAlloc(size, alignof(std::max_align_t)); }
+void *operator new(size_t size, std::align_val_t align) { return CountedAlloc(size, static_cast<size_t>(align)); }
+void operator delete(void *memory) noexcept { std::free(memory); }
+void operator delete(void *memory, size_t) noexcept { std::free(memory); }
+void operator delete(void *memory, std::align_val_t) noexcept { std::free(memory); }
+void operator delete(void *memory, size_t, std::align_val_t) noexcept { std::free(memory); }
+
+int main() {
+    const size_t count = 1000000;
+    ReportBytesPerElement<s21::set<int>>("set<int>", count, [&](s21::set<int> &set) {
+        for (size_t i = 0; i < count; ++i) set.insert(static_cast<int>(i));
+    });
+    std::vector<std::string> urls(count);
+    for (size_t i = 0; i < count; ++i) {
+        urls[i] = "https://example.com/page/" + std::to_string(i);
+        urls[i].resize(40, 'x');
+    }
+    ReportBytesPerElement<s21::set<std::string>>("set<string> (40-char urls)", count, [&](s21::set<std::string> &set) {
+        for (const std::string &url : urls) set.insert(url);
+    });
+    ReportBytesPerElement<s21::map<int, int>>("map<int, int>", count, [&](s21::map<int, int> &map) {
+        for (size_t i = 0; i < count; ++i) map.insert(static_cast<int>(i), 0);
+    });
+    return 0;
+}
@@ -0,0 +1,63 @@
+#include <algorithm>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "bench_entry.h"
+
+// Точечный поиск по целочисленному ключу: s21::map (O(log n) сравнений) против s21::unordered_map (Swiss table)
+// и std::unordered_map (цепочки). Меряются вставка, поиск существующих ключей, поиск отсутствующих и удаление.
+
+namespace {
+    template<typename Map>
+    void Run(const char *name, const std::vector<int> &keys, const std::vector<int> &hits, const std::vector<int> &misses) {
+        Map map;
+        double ms = bench::MeasureMs([&] {
+            for (int key : keys) map.insert({key, key});
+        });
+        std::string label = std::string(name) + ", insert";
+        bench::Report(label.c_str(), keys.size(), ms);
+
+        size_t checksum = 0;
+        ms = bench::MeasureMs([&] {
+            for (int key : hits) checksum += static_cast<size_t>(map.find(key)->second);
+        });
+        label = std::string(name) + ", find (hit)";
+        bench::Report(label.c_str(), hits.size(), ms);
+
+        ms = bench::MeasureMs([&] {
+            for (int key : misses) checksum += map.find(key) == map.end() ? 1 : 0;
+        });
+        label = std::string(name) + ", find (miss)";
+        bench::Report(label.c_str(), misses.size(), ms);
+
+        ms = bench::MeasureMs([&] {
+            for (int key : hits) map.erase(map.find(key));
+        });
+        bench::DoNotOptimize(checksum);
+        label = std::string(name) + ", erase";
+        bench::Report(label.c_str(), hits.size(), ms);
+    }
+} // namespace
+
+int main() {
+    const size_t count = 1000000;
+    std::mt19937 gen(17);
+    // четные ключи лежат в контейнере, нечетные - нет
+    std::vector<int> keys(count);
+    std::vector<int> misses(count);
+    for (size_t i = 0; i < count; ++i) {
+        keys[i] = static_cast<int>(2 * i);
+        misses[i] = static_cast<int>(2 * i + 1);
+    }
+    std::shuffle(keys.begin(), keys.end(), gen);
+    std::shuffle(misses.begin(), misses.end(), gen);
+    std::vector<int> hits = keys;
+    std::shuffle(hits.begin(), hits.end(), gen);
+
+    Run<s21::map<int, int>>("map<int, int>", keys, hits, misses);
+    Run<s21::unordered_map<int, int>>("unordered_map<int, int>", keys, hits, misses);
+    Run<std::unordered_map<int, int>>("std::unordered_map<int, int>", keys, hits, misses);
+    return 0;
+}
@@ -5,6 +5,7 @@
 #include "s21_containers/list/s21_list.h"
 #include "s21_containers/map/s21_map.h"
 #include "s21_containers/set/s21_set.h"
+#include "s21_containers/multiset/s21_multiset.h"
 #include "s21_containers/stack/s21_stack.h"
 #include "s21_containers/queue/s21_queue.h"
 
@@ -1,18 +1,36 @@
 #ifndef SRC_BINARYTREE_H
 #define SRC_BINARYTREE_H
 
+#include <algorithm>
+#include <functional>
 #include <iostream>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
 #include <sys/sysctl.h>
 #include <sys/types.h>
 
+#include "KeyOfValue.h"
+#include "NodePool.h"
+
 namespace s21 {
-    template<typename Key, typename Value>
+    // в узле хранится только Value, ключ из него достает KeyOfValue (см. KeyOfValue.h)
+    // Compare задает порядок ключей (по умолчанию std::less<Key>). Если у компаратора есть тип is_transparent,
+    // поиск доступен по любому типу, сравнимому с Key (например, std::string_view для ключей std::string)
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare = std::less<Key>>
     class BinaryTree {
     protected:
         struct Node;
+        struct Header;
     public:
         class Iterator;
         class ConstIterator;
+        class NodeHandle;
+        template<typename It, typename Handle>
+        struct InsertReturn;
 
         using key_type = Key;
         using value_type = Value;
@@ -21,15 +39,24 @@ namespace s21 {
         using iterator = Iterator;
         using const_iterator = ConstIterator;
         using size_type = size_t;
+        using key_compare = Compare;
+        using node_type = NodeHandle;
+        using insert_return_type = InsertReturn<iterator, node_type>;
 
         class Iterator {
         public:
-            friend class BinaryTree<Key, Value>;
+            friend class BinaryTree<Key, Value, KeyOfValue, Compare>;
+            using iterator_category = std::bidirectional_iterator_tag;
+            using difference_type = std::ptrdiff_t;
+            using value_type = Value;
+            using pointer = Value *;
+            using reference = Value &;
 
             Iterator();
-            Iterator(Node* node, Node* prev_node);
+            Iterator(Node* node, const Header *header = nullptr);
 
-            reference operator*() const; // returns node key (key value)
+            reference operator*() const; // returns the stored value (the key for set, the key-value pair for map)
+            value_type *operator->() const;
             Iterator &operator++();
             Iterator operator++(int);
             Iterator &operator--();
@@ -38,19 +65,50 @@ namespace s21 {
             bool operator!=(const Iterator &other);
 
         protected:
-            Node* it_node_;
-            Node* it_prev_node_;
-            Node *MoveForward(Node *node);
-            Node *MoveBack(Node *node);
+            Node* it_node_; // nullptr for end()
+            const Header *it_header_; // header of the tree, --end() takes the last node from it
+            static Node *MoveForward(Node *node);
+            static Node *MoveBack(Node *node);
         };
 
         class ConstIterator : public Iterator {
         public:
             ConstIterator() : Iterator() {};
 //            ConstIterator(Node* node, Node* prev_node) : Iterator(Node* node, Node* prev_node) {};
+            ConstIterator(Node *node, const Header *header = nullptr) : Iterator(node, header) {};
             const_reference operator*() const { return Iterator::operator*(); };
         };
 
+        // узел, вынутый из дерева через extract: владеет узлом и держит пулы, в которых лежит его память,
+        // так что узел переходит в другое дерево того же типа без копирования значения и нового выделения
+        class NodeHandle {
+        public:
+            friend class BinaryTree<Key, Value, KeyOfValue, Compare>;
+            NodeHandle() = default;
+            NodeHandle(NodeHandle &&other) noexcept;
+            NodeHandle &operator=(NodeHandle &&other) noexcept;
+            ~NodeHandle(); // destroys the node if it was not inserted anywhere
+
+            bool empty() const { return node_ == nullptr; };
+            explicit operator bool() const { return node_ != nullptr; };
+            value_type &value() const { return node_->value_; }; // the stored value; the handle must not be empty
+            const key_type &key() const { return KeyOf(node_); };
+            void swap(NodeHandle &other) noexcept;
+
+        protected:
+            Node *node_ = nullptr;
+            std::shared_ptr<NodePool<Node>> pool_; // pool_ of the tree the node was extracted from
+            std::vector<std::shared_ptr<NodePool<Node>>> foreign_pools_; // and its foreign_pools_
+        };
+
+        // result of insert(node_type &&): if the key was already there, node keeps the handle
+        template<typename It, typename Handle>
+        struct InsertReturn {
+            It position;
+            bool inserted;
+            Handle node;
+        };
+
         BinaryTree(); // default constructor
         BinaryTree(const BinaryTree &other); // copy constructor
         BinaryTree(BinaryTree &&other) noexcept; // move constructor
@@ -60,379 +118,1674 @@ namespace s21 {
 
         iterator begin();
         iterator end();
+        const_iterator cbegin() const;
+        const_iterator cend() const;
 
         void clear(); // clears the tree contents
-        bool empty(); // checks whether the container is empty
-        size_type size(); // returns the number of elements
+        bool empty() const; // checks whether the container is empty
+        size_type size() const; // returns the number of elements
         size_type max_size(); // returns the maximum possible number of elements
         std::pair<iterator, bool> insert(const key_type &key); // inserts node and returns iterator to where the element is in the container and bool denoting whether the insertion took place
+        std::pair<iterator, bool> insert(key_type &&key);
+        // inserts key as close as possible to just before hint; if key goes right next to hint, the tree is not
+        // searched from the root, so inserting sorted keys with hint end() costs no key comparisons beyond the neighbours
+        iterator insert(iterator hint, const key_type &key);
+        iterator insert(iterator hint, key_type &&key);
+        // unlinks the element from the tree and returns it as a node handle (empty if there is no such key)
+        node_type extract(iterator pos);
+        node_type extract(const key_type &key);
+        // links the node of nh into the tree without copying or allocating; if the key is already here,
+        // nh is moved to the node field of the result and position points to the element with the key
+        insert_return_type insert(node_type &&nh);
+        iterator insert(iterator hint, node_type &&nh);
         void erase(iterator pos); // erases element at pos
+        iterator erase(iterator first, iterator last); // erases [first, last) and returns last
         void swap(BinaryTree &other); // swaps the contents
-        void merge(BinaryTree &other); // splices nodes from another container
+        // replaces the contents with [first, last): sorted input is built bottom-up in O(n), any other input
+        // is sorted first; of elements with equal keys the first one is kept
+        template<typename InputIt>
+        void assign_sorted(InputIt first, InputIt last);
+        void merge(BinaryTree &other); // moves the nodes of other whose keys are not here yet (no copies, no allocations)
+        // moves the elements less than key to left and the greater ones to right in O(log n), replacing what was
+        // there; only the element with key stays here. Returns whether there is one
+        bool split(const Key &key, BinaryTree &left, BinaryTree &right);
+        // replaces the contents with left, value and right in O(log n) and leaves left and right empty;
+        // the keys of left must be less than the key of value and the keys of right greater (std::invalid_argument)
+        void join(BinaryTree &left, const value_type &value, BinaryTree &right);
         bool contains(const Key &key);
+        template<typename K, typename C = Compare, typename = typename C::is_transparent>
+        bool contains(const K &key);
+        size_type count(const Key &key); // returns the number of elements with key (0 or 1)
+        template<typename K, typename C = Compare, typename = typename C::is_transparent>
+        size_type count(const K &key);
+        key_compare key_comp() const; // returns the function that compares keys
+        iterator find_by_order(size_type k); // returns iterator to the k-th smallest element (from 0) or end()
+        size_type order_of_key(const Key &key); // returns the number of elements less than key
+        iterator lower_bound(const Key &key); // returns iterator to the first element not less than key or end()
+        template<typename K, typename C = Compare, typename = typename C::is_transparent>
+        iterator lower_bound(const K &key);
+        iterator upper_bound(const Key &key); // returns iterator to the first element greater than key or end()
+        template<typename K, typename C = Compare, typename = typename C::is_transparent>
+        iterator upper_bound(const K &key);
+        std::pair<iterator, iterator> equal_range(const Key &key); // returns the range of elements with key
+        template<typename K, typename C = Compare, typename = typename C::is_transparent>
+        std::pair<iterator, iterator> equal_range(const K &key);
 
     protected:
-        iterator Find(const Key &key);
+        template<typename K>
+        iterator Find(const K &key);
         struct Node {
-            Node(key_type key, value_type value);
-            Node(key_type key, value_type value, Node* parent);
-            key_type key_;
+            // value_ is built in place from args
+            template<typename... Args>
+            explicit Node(Node *parent, Args &&...args);
             value_type value_;
             Node* left_ = nullptr;
             Node* right_ = nullptr;
             Node* parent_ = nullptr;
-            int height_ = 0;
-            int size_ = 0;
-            friend class BinaryTree<Key, Value>;
+            int height_ = 1; // height of the subtree rooted at this node (leaf = 1)
+            size_type size_ = 1; // number of nodes in the subtree rooted at this node
+            friend class BinaryTree<Key, Value, KeyOfValue, Compare>;
     };
+        // заголовок (sentinel) дерева: на него указывают итераторы end(), поэтому --end() сразу находит последний
+        // узел, а begin() и end() не спускаются по дереву. Корень, как и раньше, без родителя
+        struct Header {
+            Node *leftmost_ = nullptr; // first node in order, nullptr for an empty tree
+            Node *rightmost_ = nullptr; // last node in order
+        };
+        Header header_;
+        // новые узлы дерева создаются в pool_; merge переносит узлы другого дерева вместе с владением его пулами,
+        // поэтому пулы общие (shared_ptr), а в foreign_pools_ лежат чужие пулы, пока их узлы могут жить здесь
+        std::shared_ptr<NodePool<Node>> pool_; // created on first use
+        std::vector<std::shared_ptr<NodePool<Node>>> foreign_pools_;
+        Compare comp_;
         Node * root_;
+        size_type size_; // number of elements, kept by every modifying operation
 
-        // copy and delete tree
-//        Node* CopyTree(const Node &node, const Node &parent);
-        Node *CopyTree(Node *node, Node *parent);
+        // copy and delete tree (iterative, the stack depth does not depend on the tree height)
+        Node *CopyTree(Node *node);
         void FreeTree(Node *node);
+        NodePool<Node> &Pool(); // the pool new nodes of this tree are created in
+        void AdoptPools(const BinaryTree &other); // keeps the pools of other alive while its nodes may live here
+
+        // the tree as a sorted list linked through right_ (left_ and the rest of the fields are garbage)
+        static Node *TreeToList(Node *root);
+        static void PushBack(Node *&head, Node *&tail, Node *node); // appends node to a right_-linked list
+        // builds a balanced tree out of the first count nodes of the list and advances head past them
+        static Node *BuildFromList(Node *&head, size_type count);
+        // sorts the list by key (equal keys keep their order), destroys repeated keys if unique is set
+        // and returns the new length
+        size_type SortList(Node *&head, bool unique = true);
+        void DestroyList(Node *head);
+        void UpdateHeader(); // finds the first and the last node again after the tree is rebuilt as a whole
+        // assign_sorted that also keeps elements with equal keys if unique is not set
+        template<typename InputIt>
+        void AssignSorted(InputIt first, InputIt last, bool unique);
 
+        static const Key &KeyOf(const Node *node) { return KeyOfValue()(node->value_); }
         static Node *GetMin(Node *node);
         static Node *GetMax(Node *node);
+        Node *GetByOrder(size_type k);
 
-        Node *RecursiveFind(Node *node, const Key &key);
-        bool RecursiveInsert(Node *node, const Key &key, Value value);
-        Node *RecursiveDelete(Node *node, Key key);
-        size_t RecursiveSize(Node *node);
+        template<typename K>
+        Node *FindNode(const K &key) const;
+        template<typename K>
+        Node *LowerBoundNode(const K &key) const; // first node not less than key or nullptr
+        template<typename K>
+        Node *UpperBoundNode(const K &key) const; // first node greater than key or nullptr
+        template<typename K>
+        std::pair<Node *, Node *> EqualRangeNodes(const K &key) const; // bounds of the range of nodes with key
+        iterator MakeIterator(Node *node); // iterator to node, end() for nullptr
+        // finds the node with key or, if there is none, the parent and the side to link a new node to
+        Node *FindInsertPosition(const Key &key, Node *&parent, bool &to_left) const;
+        // the same, but first checks whether key goes between hint (nullptr for end()) and its neighbour
+        Node *FindHintPosition(Node *hint, const Key &key, Node *&parent, bool &to_left) const;
+        void LinkNode(Node *node, Node *parent, bool to_left); // links a new leaf found by FindInsertPosition
+        // returns the node with key and whether the insertion took place;
+        // a new node is built in place from args (its value must have key) only if the key is not in the tree yet
+        template<typename... Args>
+        std::pair<Node *, bool> EmplaceUnique(const Key &key, Args &&...args);
+        template<typename... Args>
+        std::pair<Node *, bool> EmplaceHintUnique(Node *hint, const Key &key, Args &&...args);
+        // builds a new node from args and links it after every node with key; for containers with repeated keys
+        template<typename... Args>
+        Node *EmplaceMulti(const Key &key, Args &&...args);
+        void DeleteNode(Node *node); // unlinks node from the tree and destroys it
+        void UnlinkNode(Node *node); // takes node out of the tree, the node itself stays alive
+        node_type ExtractNode(Node *node); // unlinks node and wraps it into a handle
+        // links the node of nh if its key is not in the tree yet (hint as in FindHintPosition);
+        // returns the node with the key and whether nh was linked
+        std::pair<Node *, bool> InsertHandle(Node *hint, node_type &nh);
+        // erases the nodes from first up to last (nullptr - up to the end); a long run is cut out of the sorted list
+        // of all nodes and the tree is rebuilt in O(n), a short one is erased node by node
+        void EraseRange(Node *first, Node *last);
+        template<typename Pred>
+        size_type RemoveIf(Pred pred); // erases every element the predicate holds for in one O(n) pass
+        size_type RankOf(const Node *node) const; // number of elements before node (size_ for nullptr)
+        void ReplaceChild(Node *node, Node *child); // puts child in place of node in the node's parent
+        void RebalanceUp(Node *node); // rebalances every node on the path from node to the root
+        static Node *BalanceToRoot(Node *node); // the same for a detached tree, returns its root
+
+        // split и join на корнях без родителя; из них собраны объединение и разность за O(m log(n/m + 1))
+        // balanced tree of left, mid and right whose keys go in that order, O(|height(left) - height(right)| + 1)
+        static Node *JoinNodes(Node *left, Node *mid, Node *right);
+        static Node *JoinNodes(Node *left, Node *right); // the same without a middle node
+        // cuts the subtree into the nodes less than key, the node with key (or nullptr) and the greater ones
+        template<typename K>
+        void SplitNodes(Node *node, const K &key, Node *&left, Node *&found, Node *&right) const;
+        Node *UnionNodes(Node *lhs, Node *rhs); // of two nodes with equal keys keeps the lhs one
+        Node *DifferenceNodes(Node *lhs, const Node *rhs); // lhs without the keys of rhs; rhs is only read
+        void UnionWith(BinaryTree &other); // moves the nodes of other here, other becomes empty
+        void Subtract(const BinaryTree &other); // erases the keys of other
+        // replaces the contents with copies of the elements of lhs whose keys are in rhs
+        void AssignIntersection(const BinaryTree &lhs, const BinaryTree &rhs);
+        // lower bound of key found from finger, the lower bound of a key not greater than key
+        template<typename K>
+        Node *LowerBoundFrom(Node *finger, const K &key) const;
+
+        // AVL balancing
+        static int GetHeight(Node *node);
+        static int GetBalanceFactor(Node *node); // right subtree height minus left subtree height
+        static size_type GetSize(Node *node);
+        static void UpdateNode(Node *node); // recomputes height_ and size_ from the children
+        static Node *RotateLeft(Node *node);
+        static Node *RotateRight(Node *node);
+        static Node *Balance(Node *node); // restores the AVL invariant and returns the new subtree root
 
     };
 
     // Node constructors
-    template<typename Key, typename Value>
-    BinaryTree<Key, Value>::Node::Node(key_type key, value_type value) : key_(key), value_(value) {}
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    template<typename... Args>
+    BinaryTree<Key, Value, KeyOfValue, Compare>::Node::Node(BinaryTree::Node *parent, Args &&...args) :
+    value_(std::forward<Args>(args)...), parent_(parent) {}
+
+    // Node handle
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    BinaryTree<Key, Value, KeyOfValue, Compare>::NodeHandle::NodeHandle(NodeHandle &&other) noexcept
+            : node_(std::exchange(other.node_, nullptr)), pool_(std::move(other.pool_)),
+              foreign_pools_(std::move(other.foreign_pools_)) {}
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    typename BinaryTree<Key, Value, KeyOfValue, Compare>::NodeHandle &BinaryTree<Key, Value, KeyOfValue, Compare>::NodeHandle::operator=(NodeHandle &&other) noexcept {
+        if (this != &other) {
+            NodeHandle tmp(std::move(other));
+            swap(tmp);
+        }
+        return *this;
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    BinaryTree<Key, Value, KeyOfValue, Compare>::NodeHandle::~NodeHandle() {
+        // слот попадает в free list пула исходного дерева: пока дерево берет узлы из этого пула, оно держит
+        // и все свои чужие пулы, а после clear() в пул уже никто не обращается
+        if (node_ != nullptr) {
+            pool_->Destroy(node_);
+        }
+    }
 
-    template<typename Key, typename Value>
-    BinaryTree<Key, Value>::Node::Node(key_type key, value_type value, BinaryTree::Node *parent) :
-    key_(key), value_(value), parent_(parent) {}
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    void BinaryTree<Key, Value, KeyOfValue, Compare>::NodeHandle::swap(NodeHandle &other) noexcept {
+        std::swap(node_, other.node_);
+        pool_.swap(other.pool_);
+        foreign_pools_.swap(other.foreign_pools_);
+    }
 
     // Map Iterator Constructors and functions
-    template<typename Key, typename Value>
-    BinaryTree<Key, Value>::Iterator::Iterator() : it_node_(nullptr), it_prev_node_(nullptr) {}
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    BinaryTree<Key, Value, KeyOfValue, Compare>::Iterator::Iterator() : it_node_(nullptr), it_header_(nullptr) {}
 
-    template<typename Key, typename Value>
-    BinaryTree<Key, Value>::Iterator::Iterator(BinaryTree::Node *node, BinaryTree::Node *prev_node) : it_node_(node), it_prev_node_(prev_node) {}
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    BinaryTree<Key, Value, KeyOfValue, Compare>::Iterator::Iterator(BinaryTree::Node *node, const BinaryTree::Header *header) : it_node_(node), it_header_(header) {}
 
-    template<typename Key, typename Value>
-    Value &BinaryTree<Key, Value>::Iterator::operator*() const {
-        if (it_node_ == nullptr) {
-            static Value not_true_value{};
-            return not_true_value;
-        }
-        return it_node_->key_; // TODO: перепроверить, точно ли нужно возвращать key, а не значение value
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    Value &BinaryTree<Key, Value, KeyOfValue, Compare>::Iterator::operator*() const {
+        // как и у std::map, разыменовывать end() нельзя
+        return it_node_->value_;
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    Value *BinaryTree<Key, Value, KeyOfValue, Compare>::Iterator::operator->() const {
+        return &operator*();
     }
 
     // TODO: как итерироваться по бинарному дереву?
-    template<typename Key, typename Value>
-    typename BinaryTree<Key, Value>::Iterator &BinaryTree<Key, Value>::Iterator::operator++() {
-        // ++it
-        Node *tmp;
-        if (it_node_ != nullptr) {
-            tmp = GetMax(it_node_);
-        }
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    typename BinaryTree<Key, Value, KeyOfValue, Compare>::Iterator &BinaryTree<Key, Value, KeyOfValue, Compare>::Iterator::operator++() {
+        // ++it; за весь обход каждое ребро проходится дважды, так что шаг в среднем O(1)
         it_node_ = MoveForward(it_node_);
-        if (it_node_ == nullptr) {
-            it_prev_node_ = tmp;
-        }
         return *this;
     }
 
-    template<typename Key, typename Value>
-    typename BinaryTree<Key, Value>::Iterator BinaryTree<Key, Value>::Iterator::operator++(int) {
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    typename BinaryTree<Key, Value, KeyOfValue, Compare>::Iterator BinaryTree<Key, Value, KeyOfValue, Compare>::Iterator::operator++(int) {
         // it++
         Iterator tmp = *this;
         operator++();
         return tmp;
     }
 
-    template<typename Key, typename Value>
-    typename BinaryTree<Key, Value>::Iterator &BinaryTree<Key, Value>::Iterator::operator--() {
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    typename BinaryTree<Key, Value, KeyOfValue, Compare>::Iterator &BinaryTree<Key, Value, KeyOfValue, Compare>::Iterator::operator--() {
         // --it
-        if (it_node_ == nullptr && it_prev_node_ != nullptr) {
-            *this = it_prev_node_;
+        if (it_node_ == nullptr) {
+            it_node_ = it_header_->rightmost_;
             return *this;
         }
         it_node_ = MoveBack(it_node_);
         return *this;
     }
 
-    template<typename Key, typename Value>
-    typename BinaryTree<Key, Value>::Iterator BinaryTree<Key, Value>::Iterator::operator--(int) {
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    typename BinaryTree<Key, Value, KeyOfValue, Compare>::Iterator BinaryTree<Key, Value, KeyOfValue, Compare>::Iterator::operator--(int) {
         // it--
         Iterator tmp = *this;
         operator--();
         return tmp;
     }
 
-    template<typename Key, typename Value>
-    bool BinaryTree<Key, Value>::Iterator::operator==(const BinaryTree::Iterator &other) {
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    bool BinaryTree<Key, Value, KeyOfValue, Compare>::Iterator::operator==(const BinaryTree::Iterator &other) {
         return it_node_ == other.it_node_;
     }
 
-    template<typename Key, typename Value>
-    bool BinaryTree<Key, Value>::Iterator::operator!=(const BinaryTree::Iterator &other) {
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    bool BinaryTree<Key, Value, KeyOfValue, Compare>::Iterator::operator!=(const BinaryTree::Iterator &other) {
         return it_node_ != other.it_node_;
     }
 
     // Binary Tree constructors
-    template<typename Key, typename Value>
-    BinaryTree<Key, Value>::BinaryTree() : root_(nullptr) {}
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    BinaryTree<Key, Value, KeyOfValue, Compare>::BinaryTree() : root_(nullptr), size_(0) {}
 
-    template<typename Key, typename Value>
-    BinaryTree<Key, Value>::BinaryTree(const BinaryTree &other) {
-        root_ = CopyTree(other.root_, nullptr);
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    BinaryTree<Key, Value, KeyOfValue, Compare>::BinaryTree(const BinaryTree &other) : comp_(other.comp_) {
+        root_ = CopyTree(other.root_);
+        size_ = other.size_;
+        UpdateHeader();
     }
 
-    template<typename Key, typename Value>
-    BinaryTree<Key, Value>::BinaryTree(BinaryTree &&other) noexcept {
-        this->root_ = other.root_;
-        other.root_ = nullptr;
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    BinaryTree<Key, Value, KeyOfValue, Compare>::BinaryTree(BinaryTree &&other) noexcept
+            : pool_(std::move(other.pool_)), foreign_pools_(std::move(other.foreign_pools_)),
+              comp_(std::move(other.comp_)) {
+        other.foreign_pools_.clear();
+        this->root_ = std::exchange(other.root_, nullptr);
+        this->size_ = std::exchange(other.size_, 0);
+        header_ = std::exchange(other.header_, Header());
     } // TODO: нужна ли здесь рекурсия? Где вообще будем использовать конструктор перемещения?
 
-    template<typename Key, typename Value>
-    BinaryTree<Key, Value>::~BinaryTree() {
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    BinaryTree<Key, Value, KeyOfValue, Compare>::~BinaryTree() {
         clear();
     }
 
-    template<typename Key, typename Value>
-    BinaryTree<Key, Value> &BinaryTree<Key, Value>::operator=(const BinaryTree &other) {
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    BinaryTree<Key, Value, KeyOfValue, Compare> &BinaryTree<Key, Value, KeyOfValue, Compare>::operator=(const BinaryTree &other) {
         if (this != &other) {
             BinaryTree tmp(other);
-            FreeTree(root_);
             *this = std::move(tmp);
         }
         return *this;
     }
 
-    template<typename Key, typename Value>
-    BinaryTree<Key, Value> &BinaryTree<Key, Value>::operator=(BinaryTree &&other) noexcept {
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    BinaryTree<Key, Value, KeyOfValue, Compare> &BinaryTree<Key, Value, KeyOfValue, Compare>::operator=(BinaryTree &&other) noexcept {
         if (this != &other) {
-            this->root_ = other.root_;
-            other.root_ = nullptr;
+            clear();
+            pool_ = std::move(other.pool_);
+            foreign_pools_ = std::move(other.foreign_pools_);
+            other.foreign_pools_.clear();
+            comp_ = std::move(other.comp_);
+            this->root_ = std::exchange(other.root_, nullptr);
+            this->size_ = std::exchange(other.size_, 0);
+            header_ = std::exchange(other.header_, Header());
         }
         return *this;
     }
 
 
-    // Copy tree (recursive)
-    template<typename Key, typename Value>
-    typename BinaryTree<Key, Value>::Node *BinaryTree<Key, Value>::CopyTree(BinaryTree::Node *node,
-                                                                   BinaryTree::Node *parent) {
+template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    NodePool<typename BinaryTree<Key, Value, KeyOfValue, Compare>::Node> &BinaryTree<Key, Value, KeyOfValue, Compare>::Pool() {
+        if (pool_ == nullptr) {
+            pool_ = std::make_shared<NodePool<Node>>();
+        }
+        return *pool_;
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    void BinaryTree<Key, Value, KeyOfValue, Compare>::AdoptPools(const BinaryTree &other) {
+        auto adopt = [this](const std::shared_ptr<NodePool<Node>> &pool) {
+            if (pool != nullptr && pool != pool_ &&
+                std::find(foreign_pools_.begin(), foreign_pools_.end(), pool) == foreign_pools_.end()) {
+                foreign_pools_.push_back(pool);
+            }
+        };
+        adopt(other.pool_);
+        for (const auto &pool : other.foreign_pools_) {
+            adopt(pool);
+        }
+    }
+
+    // In-order walk that only rewrites right_ of the nodes it has already passed:
+    // the successor is found through left_ and parent_, which stay intact
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    typename BinaryTree<Key, Value, KeyOfValue, Compare>::Node *BinaryTree<Key, Value, KeyOfValue, Compare>::TreeToList(BinaryTree::Node *root) {
+        Node *head = nullptr;
+        Node *tail = nullptr;
+        Node *node = root == nullptr ? nullptr : GetMin(root);
+        while (node != nullptr) {
+            Node *next = nullptr;
+            if (node->right_ != nullptr) {
+                next = GetMin(node->right_);
+            } else {
+                Node *child = node;
+                next = node->parent_;
+                while (next != nullptr && child != next->left_) {
+                    child = next;
+                    next = next->parent_;
+                }
+            }
+            PushBack(head, tail, node);
+            node = next;
+        }
+        return head;
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    void BinaryTree<Key, Value, KeyOfValue, Compare>::PushBack(BinaryTree::Node *&head, BinaryTree::Node *&tail, BinaryTree::Node *node) {
+        if (tail == nullptr) {
+            head = node;
+        } else {
+            tail->right_ = node;
+        }
+        tail = node;
+        node->right_ = nullptr;
+    }
+
+    // Recursion depth is the height of the built tree, i.e. about log2(count)
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    typename BinaryTree<Key, Value, KeyOfValue, Compare>::Node *BinaryTree<Key, Value, KeyOfValue, Compare>::BuildFromList(BinaryTree::Node *&head, size_type count) {
+        if (count == 0) {
+            return nullptr;
+        }
+        size_type left_count = (count - 1) / 2;
+        Node *left = BuildFromList(head, left_count);
+        Node *node = head;
+        head = head->right_;
+        node->parent_ = nullptr;
+        node->left_ = left;
+        node->right_ = BuildFromList(head, count - 1 - left_count);
+        if (node->left_ != nullptr) {
+            node->left_->parent_ = node;
+        }
+        if (node->right_ != nullptr) {
+            node->right_->parent_ = node;
+        }
+        UpdateNode(node);
+        return node;
+    }
+
+template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    typename BinaryTree<Key, Value, KeyOfValue, Compare>::size_type BinaryTree<Key, Value, KeyOfValue, Compare>::SortList(BinaryTree::Node *&head, bool unique) {
+        std::vector<Node *> nodes;
+        for (Node *node = head; node != nullptr; node = node->right_) {
+            nodes.push_back(node);
+        }
+        // stable_sort оставляет равные ключи в исходном порядке, поэтому сохраняется первый из них
+        std::stable_sort(nodes.begin(), nodes.end(),
+                         [this](const Node *lhs, const Node *rhs) { return comp_(KeyOf(lhs), KeyOf(rhs)); });
+        head = nullptr;
+        Node *tail = nullptr;
+        size_type count = 0;
+        for (Node *node : nodes) {
+            if (unique && tail != nullptr && !comp_(KeyOf(tail), KeyOf(node))) {
+                Pool().Destroy(node);
+            } else {
+                PushBack(head, tail, node);
+                ++count;
+            }
+        }
+        return count;
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    void BinaryTree<Key, Value, KeyOfValue, Compare>::UpdateHeader() {
+        header_.leftmost_ = root_ == nullptr ? nullptr : GetMin(root_);
+        header_.rightmost_ = root_ == nullptr ? nullptr : GetMax(root_);
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    void BinaryTree<Key, Value, KeyOfValue, Compare>::DestroyList(BinaryTree::Node *head) {
+        while (head != nullptr) {
+            Node *next = head->right_;
+            Pool().Destroy(head);
+            head = next;
+        }
+    }
+
+    // Copy tree (pre-order walk that follows the parent links instead of recursion)
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    typename BinaryTree<Key, Value, KeyOfValue, Compare>::Node *BinaryTree<Key, Value, KeyOfValue, Compare>::CopyTree(BinaryTree::Node *node) {
         if (node == nullptr) {
             return nullptr;
         }
-        Node *new_node = new Node(node->key_, node->value_, parent);
-        new_node->left_ = CopyTree(node->left_, new_node);
-        new_node->right_ = CopyTree(node->right_, new_node);
-        return new_node;
+        Node *copy_root = Pool().Create(nullptr, node->value_);
+        copy_root->height_ = node->height_;
+        copy_root->size_ = node->size_;
+        Node *source = node;
+        Node *copy = copy_root;
+        while (source != nullptr) {
+            Node *next = nullptr;
+            if (source->left_ != nullptr && copy->left_ == nullptr) {
+                next = source->left_;
+                copy->left_ = Pool().Create(copy, next->value_);
+                copy = copy->left_;
+            } else if (source->right_ != nullptr && copy->right_ == nullptr) {
+                next = source->right_;
+                copy->right_ = Pool().Create(copy, next->value_);
+                copy = copy->right_;
+            }
+            if (next != nullptr) {
+                copy->height_ = next->height_;
+                copy->size_ = next->size_;
+                source = next;
+            } else {
+                // оба поддерева скопированы - поднимаемся к родителю
+                source = source == node ? nullptr : source->parent_;
+                copy = copy->parent_;
+            }
+        }
+        return copy_root;
     }
 
-    // Delete tree (recursive)
-    template<typename Key, typename Value>
-    void BinaryTree<Key, Value>::FreeTree(BinaryTree::Node *node) {
+    // Delete tree (post-order walk that follows the parent links instead of recursion)
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    void BinaryTree<Key, Value, KeyOfValue, Compare>::FreeTree(BinaryTree::Node *node) {
         if (node == nullptr) {
             return;
         }
-        FreeTree(node->right_);
-        FreeTree(node->left_);
-        delete node;
+        Node *stop = node->parent_;
+        while (node != stop) {
+            if (node->left_ != nullptr) {
+                node = node->left_;
+            } else if (node->right_ != nullptr) {
+                node = node->right_;
+            } else {
+                Node *parent = node->parent_;
+                if (parent != stop) {
+                    if (parent->left_ == node) {
+                        parent->left_ = nullptr;
+                    } else {
+                        parent->right_ = nullptr;
+                    }
+                }
+                Pool().Destroy(node);
+                node = parent;
+            }
+        }
     }
 
-    template<typename Key, typename Value>
-    void BinaryTree<Key, Value>::clear() {
-        if (root_ != nullptr) {
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    void BinaryTree<Key, Value, KeyOfValue, Compare>::clear() {
+        // узлы с тривиальными деструкторами не нужно обходить - пул освобождает их память целиком
+        if (!NodePool<Node>::kTrivialRelease) {
             FreeTree(root_);
-            root_ = nullptr;
         }
+        // свободные слоты pool_ могут лежать в чужих пулах, поэтому pool_ сбрасывается раньше, чем foreign_pools_
+        if (pool_.use_count() == 1) {
+            pool_->Release();
+        } else {
+            pool_.reset(); // узлы из пула еще живут в другом дереве - пул освободит последний владелец
+        }
+        foreign_pools_.clear();
+        root_ = nullptr;
+        size_ = 0;
+        header_ = Header();
     }
 
-    template<typename Key, typename Value>
-    bool BinaryTree<Key, Value>::empty() {
-        return root_ == nullptr;
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    bool BinaryTree<Key, Value, KeyOfValue, Compare>::empty() const {
+        return size_ == 0;
     }
 
-    template<typename Key, typename Value>
-    size_t BinaryTree<Key, Value>::size() {
-        return RecursiveSize(root_);
-//        return root_->size_; // TODO: так ли нужно определять кол-во элементов?
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    size_t BinaryTree<Key, Value, KeyOfValue, Compare>::size() const {
+        return size_;
     }
 
-    template<typename Key, typename Value>
-    size_t BinaryTree<Key, Value>::max_size() {
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    size_t BinaryTree<Key, Value, KeyOfValue, Compare>::max_size() {
         return std::numeric_limits<size_type>::max() /
-               sizeof(typename BinaryTree<Key, Value>::Node);
+               sizeof(typename BinaryTree<Key, Value, KeyOfValue, Compare>::Node);
     }
 
-    template<typename Key, typename Value>
-    std::pair<typename BinaryTree<Key, Value>::Iterator, bool> BinaryTree<Key, Value>::insert(const key_type &key) {
-        std::pair<Iterator, bool> return_value;
-        if (root_ == nullptr) {
-            root_ = new Node(key, key);
-            return_value.first = Iterator(root_);
-            return_value.second = true;
-        } else {
-            bool was_insert = RecursiveInsert(root_, key, key);
-            return_value.first = Find(key);
-            return_value.second = was_insert;
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    std::pair<typename BinaryTree<Key, Value, KeyOfValue, Compare>::Iterator, bool> BinaryTree<Key, Value, KeyOfValue, Compare>::insert(const key_type &key) {
+        std::pair<Node *, bool> result = EmplaceUnique(key, key);
+        return std::pair<Iterator, bool>(MakeIterator(result.first), result.second);
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    std::pair<typename BinaryTree<Key, Value, KeyOfValue, Compare>::Iterator, bool> BinaryTree<Key, Value, KeyOfValue, Compare>::insert(key_type &&key) {
+        std::pair<Node *, bool> result = EmplaceUnique(key, std::move(key));
+        return std::pair<Iterator, bool>(MakeIterator(result.first), result.second);
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    typename BinaryTree<Key, Value, KeyOfValue, Compare>::Iterator BinaryTree<Key, Value, KeyOfValue, Compare>::insert(BinaryTree::Iterator hint,
+                                                                                              const key_type &key) {
+        return MakeIterator(EmplaceHintUnique(hint.it_node_, key, key).first);
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    typename BinaryTree<Key, Value, KeyOfValue, Compare>::Iterator BinaryTree<Key, Value, KeyOfValue, Compare>::insert(BinaryTree::Iterator hint,
+                                                                                              key_type &&key) {
+        return MakeIterator(EmplaceHintUnique(hint.it_node_, key, std::move(key)).first);
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    typename BinaryTree<Key, Value, KeyOfValue, Compare>::NodeHandle BinaryTree<Key, Value, KeyOfValue, Compare>::extract(BinaryTree::Iterator pos) {
+        return ExtractNode(pos.it_node_);
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    typename BinaryTree<Key, Value, KeyOfValue, Compare>::NodeHandle BinaryTree<Key, Value, KeyOfValue, Compare>::extract(const key_type &key) {
+        Node *node = FindNode(key);
+        if (node == nullptr) {
+            return NodeHandle();
+        }
+        return ExtractNode(node);
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    typename BinaryTree<Key, Value, KeyOfValue, Compare>::insert_return_type BinaryTree<Key, Value, KeyOfValue, Compare>::insert(NodeHandle &&nh) {
+        if (nh.empty()) {
+            return insert_return_type{end(), false, NodeHandle()};
+        }
+        std::pair<Node *, bool> result = InsertHandle(nullptr, nh);
+        if (result.second) {
+            return insert_return_type{MakeIterator(result.first), true, NodeHandle()};
         }
-        if (return_value.second) {
-            root_->size_ = root_->size_ + 1; // TODO: переписать с префиксом ++
+        return insert_return_type{MakeIterator(result.first), false, std::move(nh)};
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    typename BinaryTree<Key, Value, KeyOfValue, Compare>::Iterator BinaryTree<Key, Value, KeyOfValue, Compare>::insert(BinaryTree::Iterator hint,
+                                                                                              NodeHandle &&nh) {
+        if (nh.empty()) {
+            return end();
         }
-        return return_value;
+        return MakeIterator(InsertHandle(hint.it_node_, nh).first);
     }
 
-    template<typename Key, typename Value>
-    void BinaryTree<Key, Value>::erase(BinaryTree::Iterator pos) {
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    void BinaryTree<Key, Value, KeyOfValue, Compare>::erase(BinaryTree::Iterator pos) {
         if (root_ == nullptr || pos.it_node_ == nullptr) {
             return;
         }
-        root_ = RecursiveDelete(root_, *pos);
-        if (root_ != nullptr) {
-            root_->size_--;
+        DeleteNode(pos.it_node_);
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    typename BinaryTree<Key, Value, KeyOfValue, Compare>::Iterator BinaryTree<Key, Value, KeyOfValue, Compare>::erase(BinaryTree::Iterator first, BinaryTree::Iterator last) {
+        if (first.it_node_ != nullptr) {
+            EraseRange(first.it_node_, last.it_node_);
         }
+        return last;
     }
 
-    template<typename Key, typename Value>
-    void BinaryTree<Key, Value>::swap(BinaryTree &other) {
+template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    void BinaryTree<Key, Value, KeyOfValue, Compare>::swap(BinaryTree &other) {
+        std::swap(pool_, other.pool_);
+        std::swap(foreign_pools_, other.foreign_pools_);
+        std::swap(comp_, other.comp_);
         std::swap(root_, other.root_);
+        std::swap(size_, other.size_);
+        std::swap(header_, other.header_);
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    template<typename InputIt>
+    void BinaryTree<Key, Value, KeyOfValue, Compare>::assign_sorted(InputIt first, InputIt last) {
+        AssignSorted(first, last, true);
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    template<typename InputIt>
+    void BinaryTree<Key, Value, KeyOfValue, Compare>::AssignSorted(InputIt first, InputIt last, bool unique) {
+        clear();
+        Node *head = nullptr;
+        Node *tail = nullptr;
+        size_type count = 0;
+        bool sorted = true;
+        try {
+            for (; first != last; ++first) {
+                Node *node = Pool().Create(nullptr, *first);
+                if (sorted && tail != nullptr && !comp_(KeyOf(tail), KeyOf(node))) {
+                    if (comp_(KeyOf(node), KeyOf(tail))) {
+                        sorted = false; // дальше просто собираем узлы, порядок наведет SortList
+                    } else if (unique) {
+                        Pool().Destroy(node); // такой ключ уже есть
+                        continue;
+                    }
+                }
+                PushBack(head, tail, node);
+                ++count;
+            }
+            if (!sorted) {
+                count = SortList(head, unique);
+            }
+        } catch (...) {
+            DestroyList(head);
+            throw;
+        }
+        root_ = BuildFromList(head, count);
+        size_ = count;
+        UpdateHeader();
+    }
+
+template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    void BinaryTree<Key, Value, KeyOfValue, Compare>::merge(BinaryTree &other) {
+        if (this == &other || other.root_ == nullptr) {
+            return;
+        }
+        AdoptPools(other);
+        size_type other_size = other.size_;
+        size_type total = size_ + other_size;
+        size_type levels = 1;
+        for (size_type n = total; n > 1; n >>= 1) {
+            ++levels;
+        }
+        Node *donated = TreeToList(other.root_);
+        other.root_ = nullptr;
+        other.size_ = 0;
+        // узлы other с ключами, которые здесь уже есть, остаются в other
+        Node *rest_head = nullptr;
+        Node *rest_tail = nullptr;
+        size_type rest_size = 0;
+        if (other_size * levels < total) {
+            // other намного меньше: каждый узел переносится отдельным спуском, O(m log(n + m))
+            while (donated != nullptr) {
+                Node *node = donated;
+                donated = donated->right_;
+                Node *parent = nullptr;
+                bool to_left = false;
+                if (FindInsertPosition(KeyOf(node), parent, to_left) != nullptr) {
+                    PushBack(rest_head, rest_tail, node);
+                    ++rest_size;
+                } else {
+                    node->left_ = nullptr;
+                    node->right_ = nullptr;
+                    node->height_ = 1;
+                    node->size_ = 1;
+                    LinkNode(node, parent, to_left);
+                }
+            }
+        } else {
+            // оба дерева большие: сливаем два отсортированных списка и строим сбалансированное дерево, O(n + m)
+            Node *own = TreeToList(root_);
+            Node *head = nullptr;
+            Node *tail = nullptr;
+            while (own != nullptr || donated != nullptr) {
+                Node *next = nullptr;
+                if (donated == nullptr || (own != nullptr && comp_(KeyOf(own), KeyOf(donated)))) {
+                    next = own;
+                    own = own->right_;
+                } else {
+                    next = donated;
+                    donated = donated->right_;
+                    if (own != nullptr && !comp_(KeyOf(next), KeyOf(own))) {
+                        PushBack(rest_head, rest_tail, next);
+                        ++rest_size;
+                        continue;
+                    }
+                }
+                PushBack(head, tail, next);
+            }
+            size_ = total - rest_size;
+            root_ = BuildFromList(head, size_);
+        }
+        other.root_ = BuildFromList(rest_head, rest_size);
+        other.size_ = rest_size;
+        UpdateHeader();
+        other.UpdateHeader();
     }
 
-    template<typename Key, typename Value>
-    void BinaryTree<Key, Value>::merge(BinaryTree &other) {
-        BinaryTree other_tree(other);
-        Iterator other_it = other_tree.begin();
-        for (; other_it != other_tree.end(); ++other_it) {
-            std::pair<Iterator, bool> pr = insert(*other_it);
-            if (pr.second) other.erase(pr.first);
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    bool BinaryTree<Key, Value, KeyOfValue, Compare>::split(const Key &key, BinaryTree &left, BinaryTree &right) {
+        left.clear();
+        right.clear();
+        Node *found = nullptr;
+        SplitNodes(root_, key, left.root_, found, right.root_);
+        left.size_ = GetSize(left.root_);
+        right.size_ = GetSize(right.root_);
+        left.AdoptPools(*this);
+        right.AdoptPools(*this);
+        if (found != nullptr) {
+            found->left_ = nullptr;
+            found->right_ = nullptr;
+            UpdateNode(found);
         }
+        root_ = found;
+        size_ = GetSize(found);
+        UpdateHeader();
+        left.UpdateHeader();
+        right.UpdateHeader();
+        return found != nullptr;
     }
 
-    template<typename Key, typename Value>
-    bool BinaryTree<Key, Value>::contains(const Key &key) {
-        Node *contain_node = RecursiveFind(root_, key);
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    void BinaryTree<Key, Value, KeyOfValue, Compare>::join(BinaryTree &left, const value_type &value, BinaryTree &right) {
+        const Key &key = KeyOfValue()(value);
+        if ((left.root_ != nullptr && !comp_(KeyOf(GetMax(left.root_)), key)) ||
+            (right.root_ != nullptr && !comp_(key, KeyOf(GetMin(right.root_))))) {
+            throw std::invalid_argument("The keys of left must be less than key and the keys of right greater");
+        }
+        if (this != &left && this != &right) {
+            clear(); // если это одна из частей, ее узлы войдут в результат
+        }
+        Node *mid = Pool().Create(nullptr, value);
+        Node *left_root = left.root_;
+        Node *right_root = right.root_;
+        if (this != &left) {
+            AdoptPools(left);
+            left.root_ = nullptr;
+            left.size_ = 0;
+            left.header_ = Header();
+        }
+        if (this != &right) {
+            AdoptPools(right);
+            right.root_ = nullptr;
+            right.size_ = 0;
+            right.header_ = Header();
+        }
+        root_ = JoinNodes(left_root, mid, right_root);
+        size_ = GetSize(root_);
+        UpdateHeader();
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    bool BinaryTree<Key, Value, KeyOfValue, Compare>::contains(const Key &key) {
+        Node *contain_node = FindNode(key);
         return contain_node != nullptr;
         // return !(contain_node == nullptr);
     }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    template<typename K, typename C, typename>
+    bool BinaryTree<Key, Value, KeyOfValue, Compare>::contains(const K &key) {
+        return FindNode(key) != nullptr;
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    size_t BinaryTree<Key, Value, KeyOfValue, Compare>::count(const Key &key) {
+        return FindNode(key) != nullptr ? 1 : 0;
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    template<typename K, typename C, typename>
+    size_t BinaryTree<Key, Value, KeyOfValue, Compare>::count(const K &key) {
+        return FindNode(key) != nullptr ? 1 : 0;
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    Compare BinaryTree<Key, Value, KeyOfValue, Compare>::key_comp() const {
+        return comp_;
+    }
     
-template<typename Key, typename Value>
-    typename BinaryTree<Key, Value>::Iterator BinaryTree<Key, Value>::begin() {
-        return BinaryTree::Iterator(GetMin(root_));
+template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    typename BinaryTree<Key, Value, KeyOfValue, Compare>::Iterator BinaryTree<Key, Value, KeyOfValue, Compare>::begin() {
+        return BinaryTree::Iterator(header_.leftmost_, &header_);
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    typename BinaryTree<Key, Value, KeyOfValue, Compare>::Iterator BinaryTree<Key, Value, KeyOfValue, Compare>::end() {
+        return BinaryTree::Iterator(nullptr, &header_);
     }
 
-    template<typename Key, typename Value>
-    typename BinaryTree<Key, Value>::Iterator BinaryTree<Key, Value>::end() {
-        if (root_ == nullptr) {
-            return begin();
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    typename BinaryTree<Key, Value, KeyOfValue, Compare>::ConstIterator BinaryTree<Key, Value, KeyOfValue, Compare>::cbegin() const {
+        return ConstIterator(header_.leftmost_, &header_);
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    typename BinaryTree<Key, Value, KeyOfValue, Compare>::ConstIterator BinaryTree<Key, Value, KeyOfValue, Compare>::cend() const {
+        return ConstIterator(nullptr, &header_);
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    typename BinaryTree<Key, Value, KeyOfValue, Compare>::Iterator BinaryTree<Key, Value, KeyOfValue, Compare>::find_by_order(size_type k) {
+        Node *node = GetByOrder(k);
+        if (node == nullptr) {
+            return end();
         }
-        return BinaryTree::Iterator(GetMax(root_));
+        return Iterator(node, &header_);
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    typename BinaryTree<Key, Value, KeyOfValue, Compare>::Iterator BinaryTree<Key, Value, KeyOfValue, Compare>::lower_bound(const Key &key) {
+        return MakeIterator(LowerBoundNode(key));
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    template<typename K, typename C, typename>
+    typename BinaryTree<Key, Value, KeyOfValue, Compare>::Iterator BinaryTree<Key, Value, KeyOfValue, Compare>::lower_bound(const K &key) {
+        return MakeIterator(LowerBoundNode(key));
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    typename BinaryTree<Key, Value, KeyOfValue, Compare>::Iterator BinaryTree<Key, Value, KeyOfValue, Compare>::upper_bound(const Key &key) {
+        return MakeIterator(UpperBoundNode(key));
     }
 
-    template<typename Key, typename Value>
-    typename BinaryTree<Key, Value>::Node *BinaryTree<Key, Value>::GetMin(BinaryTree::Node *node) {
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    template<typename K, typename C, typename>
+    typename BinaryTree<Key, Value, KeyOfValue, Compare>::Iterator BinaryTree<Key, Value, KeyOfValue, Compare>::upper_bound(const K &key) {
+        return MakeIterator(UpperBoundNode(key));
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    std::pair<typename BinaryTree<Key, Value, KeyOfValue, Compare>::Iterator, typename BinaryTree<Key, Value, KeyOfValue, Compare>::Iterator>
+    BinaryTree<Key, Value, KeyOfValue, Compare>::equal_range(const Key &key) {
+        std::pair<Node *, Node *> nodes = EqualRangeNodes(key);
+        return std::make_pair(MakeIterator(nodes.first), MakeIterator(nodes.second));
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    template<typename K, typename C, typename>
+    std::pair<typename BinaryTree<Key, Value, KeyOfValue, Compare>::Iterator, typename BinaryTree<Key, Value, KeyOfValue, Compare>::Iterator>
+    BinaryTree<Key, Value, KeyOfValue, Compare>::equal_range(const K &key) {
+        std::pair<Node *, Node *> nodes = EqualRangeNodes(key);
+        return std::make_pair(MakeIterator(nodes.first), MakeIterator(nodes.second));
+    }
+
+template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    size_t BinaryTree<Key, Value, KeyOfValue, Compare>::order_of_key(const Key &key) {
+        size_type order = 0;
+        Node *node = root_;
+        while (node != nullptr) {
+            if (comp_(KeyOf(node), key)) {
+                order += GetSize(node->left_) + 1;
+                node = node->right_;
+            } else {
+                node = node->left_;
+            }
+        }
+        return order;
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    typename BinaryTree<Key, Value, KeyOfValue, Compare>::Node *BinaryTree<Key, Value, KeyOfValue, Compare>::GetByOrder(size_type k) {
+        if (k >= size_) {
+            return nullptr;
+        }
+        Node *node = root_;
+        while (node != nullptr) {
+            size_type left_size = GetSize(node->left_);
+            if (k == left_size) {
+                break;
+            }
+            if (k < left_size) {
+                node = node->left_;
+            } else {
+                k -= left_size + 1;
+                node = node->right_;
+            }
+        }
+        return node;
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    typename BinaryTree<Key, Value, KeyOfValue, Compare>::Node *BinaryTree<Key, Value, KeyOfValue, Compare>::GetMin(BinaryTree::Node *node) {
         if (node == nullptr) {
             return nullptr;
         }
-        if (node->left_ == nullptr) {
-            return node;
+        while (node->left_ != nullptr) {
+            node = node->left_;
         }
-        return GetMin(node->left_);
+        return node;
     }
 
-    template<typename Key, typename Value>
-    typename BinaryTree<Key, Value>::Node *BinaryTree<Key, Value>::GetMax(BinaryTree::Node *node) {
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    typename BinaryTree<Key, Value, KeyOfValue, Compare>::Node *BinaryTree<Key, Value, KeyOfValue, Compare>::GetMax(BinaryTree::Node *node) {
         if (node == nullptr) {
             return nullptr;
         }
-        if (node->right_ == nullptr) {
-            return node;
+        while (node->right_ != nullptr) {
+            node = node->right_;
         }
-        return GetMax(node->right_);
+        return node;
     }
 
-    template<typename Key, typename Value>
-    typename BinaryTree<Key, Value>::Node *BinaryTree<Key, Value>::RecursiveFind(BinaryTree::Node *node,
-                                                                        const Key &key) {
-        if (node == nullptr || node->key_ == key) {
-            return node;
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    template<typename K>
+    typename BinaryTree<Key, Value, KeyOfValue, Compare>::Node *BinaryTree<Key, Value, KeyOfValue, Compare>::FindNode(const K &key) const {
+        Node *node = root_;
+        while (node != nullptr) {
+            if (comp_(key, KeyOf(node))) {
+                node = node->left_;
+            } else if (comp_(KeyOf(node), key)) {
+                node = node->right_;
+            } else {
+                break;
+            }
         }
-        if (key > node->key_) {
-            return RecursiveFind(node->right_, key);
-        } else {
-            return RecursiveFind(node->left_, key);
+        return node;
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    template<typename K>
+    typename BinaryTree<Key, Value, KeyOfValue, Compare>::Iterator BinaryTree<Key, Value, KeyOfValue, Compare>::Find(const K &key) {
+        Node *search_node = FindNode(key);
+        return Iterator(search_node, &header_);
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    template<typename K>
+    typename BinaryTree<Key, Value, KeyOfValue, Compare>::Node *BinaryTree<Key, Value, KeyOfValue, Compare>::LowerBoundNode(const K &key) const {
+        Node *result = nullptr;
+        Node *node = root_;
+        while (node != nullptr) {
+            if (comp_(KeyOf(node), key)) {
+                node = node->right_;
+            } else {
+                result = node;
+                node = node->left_;
+            }
         }
+        return result;
     }
 
-    template<typename Key, typename Value>
-    typename BinaryTree<Key, Value>::Iterator BinaryTree<Key, Value>::Find(const Key &key) {
-        Node *search_node = RecursiveFind(root_, key);
-        return Iterator(search_node);
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    template<typename K>
+    typename BinaryTree<Key, Value, KeyOfValue, Compare>::Node *BinaryTree<Key, Value, KeyOfValue, Compare>::UpperBoundNode(const K &key) const {
+        Node *result = nullptr;
+        Node *node = root_;
+        while (node != nullptr) {
+            if (comp_(key, KeyOf(node))) {
+                result = node;
+                node = node->left_;
+            } else {
+                node = node->right_;
+            }
+        }
+        return result;
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    template<typename K>
+    std::pair<typename BinaryTree<Key, Value, KeyOfValue, Compare>::Node *, typename BinaryTree<Key, Value, KeyOfValue, Compare>::Node *>
+    BinaryTree<Key, Value, KeyOfValue, Compare>::EqualRangeNodes(const K &key) const {
+        Node *lower = LowerBoundNode(key);
+        if (lower == nullptr || comp_(key, KeyOf(lower))) {
+            return std::make_pair(lower, lower); // ключа нет - диапазон пустой
+        }
+        // ключи уникальны, поэтому диапазон заканчивается на следующем узле
+        Iterator next(lower);
+        ++next;
+        return std::make_pair(lower, next.it_node_);
     }
 
-    template<typename Key, typename Value>
-    bool BinaryTree<Key, Value>::RecursiveInsert(BinaryTree::Node *node, const Key &key, Value value) {
-        // Функция вернет bool значение (произошел ли insert)
-        bool was_insert = false;
-        if (key < node->key_) {
-            if (node->left_ == nullptr) {
-                node->left_ = new Node(key, value, node);
-                was_insert = true;
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    typename BinaryTree<Key, Value, KeyOfValue, Compare>::Iterator BinaryTree<Key, Value, KeyOfValue, Compare>::MakeIterator(BinaryTree::Node *node) {
+        return Iterator(node, &header_);
+    }
+
+template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    typename BinaryTree<Key, Value, KeyOfValue, Compare>::Node *BinaryTree<Key, Value, KeyOfValue, Compare>::FindInsertPosition(const Key &key,
+                                                                             BinaryTree::Node *&parent,
+                                                                             bool &to_left) const {
+        parent = nullptr;
+        to_left = false;
+        Node *node = root_;
+        while (node != nullptr) {
+            if (comp_(key, KeyOf(node))) {
+                to_left = true;
+            } else if (comp_(KeyOf(node), key)) {
+                to_left = false;
             } else {
-                was_insert = RecursiveInsert(node->left_, key, value);
+                return node;
             }
-        } else if (key > node->key_) {
-            if (node->right_ == nullptr) {
-                node->right_ = new Node(key, value, node);
-                was_insert = true;
+            parent = node;
+            node = to_left ? node->left_ : node->right_;
+        }
+        return nullptr;
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    typename BinaryTree<Key, Value, KeyOfValue, Compare>::Node *BinaryTree<Key, Value, KeyOfValue, Compare>::FindHintPosition(BinaryTree::Node *hint,
+                                                                                                   const Key &key,
+                                                                                                   BinaryTree::Node *&parent,
+                                                                                                   bool &to_left) const {
+        // между соседними по порядку узлами всегда есть свободное место: либо левый сын большего пуст,
+        // либо правый сын меньшего, так что новый лист встает туда без спуска от корня
+        if (root_ != nullptr) {
+            if (hint == nullptr) {
+                if (comp_(KeyOf(header_.rightmost_), key)) {
+                    parent = header_.rightmost_;
+                    to_left = false;
+                    return nullptr;
+                }
+            } else if (comp_(key, KeyOf(hint))) {
+                Node *prev = hint == header_.leftmost_ ? nullptr : Iterator::MoveBack(hint);
+                if (prev == nullptr || comp_(KeyOf(prev), key)) {
+                    to_left = hint->left_ == nullptr;
+                    parent = to_left ? hint : prev;
+                    return nullptr;
+                }
+            } else if (comp_(KeyOf(hint), key)) {
+                Node *next = hint == header_.rightmost_ ? nullptr : Iterator::MoveForward(hint);
+                if (next == nullptr || comp_(key, KeyOf(next))) {
+                    to_left = hint->right_ != nullptr;
+                    parent = to_left ? next : hint;
+                    return nullptr;
+                }
             } else {
-                was_insert = RecursiveInsert(node->right_, key, value);
+                return hint;
             }
-        } else if (key == node->key_) {
-            return was_insert; // Вернем false, т.к. в дереве не может быть два одинаковых ключа
         }
-//        SetHeight(node);
-//        Balance(node);
-        return was_insert;
+        // подсказка не подошла - обычный поиск от корня
+        return FindInsertPosition(key, parent, to_left);
     }
 
-    template<typename Key, typename Value>
-    typename BinaryTree<Key, Value>::Node *BinaryTree<Key, Value>::RecursiveDelete(BinaryTree::Node *node, Key key) {
-        if (node == nullptr) return nullptr;
-        if (key < node->key_) {
-            node->left_ = RecursiveDelete(node->left_, key);
-        } else if (key > node->key_) {
-            node->right_ = RecursiveDelete(node->right_, key);
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    void BinaryTree<Key, Value, KeyOfValue, Compare>::LinkNode(BinaryTree::Node *node, BinaryTree::Node *parent, bool to_left) {
+        node->parent_ = parent;
+        if (parent == nullptr) {
+            root_ = node;
+            header_.leftmost_ = node;
+            header_.rightmost_ = node;
+        } else if (to_left) {
+            parent->left_ = node;
+            if (parent == header_.leftmost_) header_.leftmost_ = node;
         } else {
-            if (node->left_ == nullptr || node->right_ == nullptr) {
-                Node *node_right = node->right_;
-                Node *node_left = node->left_;
-                Node *node_parent = node->parent_;
-                delete node;
-                if (node_left == nullptr) {
-                    node = node_right;
+            parent->right_ = node;
+            if (parent == header_.rightmost_) header_.rightmost_ = node;
+        }
+        ++size_;
+        // как только поддерево сохранило высоту (в том числе после поворота), выше меняются только размеры:
+        // дальше узлы не балансируются и соседние поддеревья не читаются
+        for (node = parent; node != nullptr; node = node->parent_) {
+            int height = node->height_;
+            Node *up = node->parent_;
+            bool is_left = up != nullptr && up->left_ == node;
+            Node *subtree = Balance(node);
+            if (up == nullptr) {
+                root_ = subtree;
+            } else if (is_left) {
+                up->left_ = subtree;
+            } else {
+                up->right_ = subtree;
+            }
+            if (subtree->height_ == height) {
+                for (node = up; node != nullptr; node = node->parent_) {
+                    ++node->size_;
+                }
+                break;
+            }
+            node = subtree;
+        }
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    template<typename... Args>
+    std::pair<typename BinaryTree<Key, Value, KeyOfValue, Compare>::Node *, bool>
+    BinaryTree<Key, Value, KeyOfValue, Compare>::EmplaceUnique(const Key &key, Args &&...args) {
+        Node *parent = nullptr;
+        bool to_left = false;
+        Node *node = FindInsertPosition(key, parent, to_left);
+        if (node != nullptr) {
+            return std::make_pair(node, false); // в дереве не может быть два одинаковых ключа
+        }
+        // args могут ссылаться на key: узел строится только после того, как поиск закончен
+        node = Pool().Create(parent, std::forward<Args>(args)...);
+        LinkNode(node, parent, to_left);
+        return std::make_pair(node, true);
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    template<typename... Args>
+    std::pair<typename BinaryTree<Key, Value, KeyOfValue, Compare>::Node *, bool>
+    BinaryTree<Key, Value, KeyOfValue, Compare>::EmplaceHintUnique(BinaryTree::Node *hint, const Key &key, Args &&...args) {
+        Node *parent = nullptr;
+        bool to_left = false;
+        Node *node = FindHintPosition(hint, key, parent, to_left);
+        if (node != nullptr) {
+            return std::make_pair(node, false);
+        }
+        node = Pool().Create(parent, std::forward<Args>(args)...);
+        LinkNode(node, parent, to_left);
+        return std::make_pair(node, true);
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    template<typename... Args>
+    typename BinaryTree<Key, Value, KeyOfValue, Compare>::Node *
+    BinaryTree<Key, Value, KeyOfValue, Compare>::EmplaceMulti(const Key &key, Args &&...args) {
+        Node *parent = nullptr;
+        bool to_left = false;
+        // на равном ключе спускаемся вправо: новый узел встает после всех равных
+        for (Node *node = root_; node != nullptr; node = to_left ? node->left_ : node->right_) {
+            to_left = comp_(key, KeyOf(node));
+            parent = node;
+        }
+        Node *node = Pool().Create(parent, std::forward<Args>(args)...);
+        LinkNode(node, parent, to_left);
+        return node;
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    void BinaryTree<Key, Value, KeyOfValue, Compare>::DeleteNode(BinaryTree::Node *node) {
+        UnlinkNode(node);
+        Pool().Destroy(node);
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    void BinaryTree<Key, Value, KeyOfValue, Compare>::UnlinkNode(BinaryTree::Node *node) {
+        // у крайнего узла нет одного из сыновей, поэтому соседний по порядку узел находится сразу
+        if (node == header_.leftmost_) {
+            header_.leftmost_ = Iterator::MoveForward(node);
+        }
+        if (node == header_.rightmost_) {
+            header_.rightmost_ = Iterator::MoveBack(node);
+        }
+        Node *rebalance_from = nullptr;
+        if (node->left_ != nullptr && node->right_ != nullptr) {
+            // на место узла переставляем его преемника (сами узлы, а не их значения)
+            Node *successor = GetMin(node->right_);
+            if (successor->parent_ != node) {
+                rebalance_from = successor->parent_;
+                ReplaceChild(successor, successor->right_);
+                successor->right_ = node->right_;
+                successor->right_->parent_ = successor;
+            } else {
+                rebalance_from = successor;
+            }
+            successor->left_ = node->left_;
+            successor->left_->parent_ = successor;
+            ReplaceChild(node, successor);
+        } else {
+            rebalance_from = node->parent_;
+            ReplaceChild(node, node->left_ != nullptr ? node->left_ : node->right_);
+        }
+        --size_;
+        RebalanceUp(rebalance_from);
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    typename BinaryTree<Key, Value, KeyOfValue, Compare>::NodeHandle BinaryTree<Key, Value, KeyOfValue, Compare>::ExtractNode(BinaryTree::Node *node) {
+        UnlinkNode(node);
+        node->left_ = nullptr;
+        node->right_ = nullptr;
+        node->parent_ = nullptr;
+        NodeHandle nh;
+        nh.node_ = node;
+        // узел может лежать в любом из пулов дерева; без чужих пулов (обычный случай) вектор не выделяет память
+        Pool();
+        nh.pool_ = pool_;
+        nh.foreign_pools_ = foreign_pools_;
+        return nh;
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    std::pair<typename BinaryTree<Key, Value, KeyOfValue, Compare>::Node *, bool>
+    BinaryTree<Key, Value, KeyOfValue, Compare>::InsertHandle(BinaryTree::Node *hint, NodeHandle &nh) {
+        Node *parent = nullptr;
+        bool to_left = false;
+        Node *node = FindHintPosition(hint, KeyOf(nh.node_), parent, to_left);
+        if (node != nullptr) {
+            return std::make_pair(node, false);
+        }
+        // память узла остается в пулах исходного дерева, теперь их держит и это дерево
+        if (nh.pool_ != pool_ && nh.pool_ != nullptr &&
+            std::find(foreign_pools_.begin(), foreign_pools_.end(), nh.pool_) == foreign_pools_.end()) {
+            foreign_pools_.push_back(std::move(nh.pool_));
+        }
+        for (auto &pool : nh.foreign_pools_) {
+            if (pool != pool_ && std::find(foreign_pools_.begin(), foreign_pools_.end(), pool) == foreign_pools_.end()) {
+                foreign_pools_.push_back(std::move(pool));
+            }
+        }
+        node = nh.node_;
+        node->height_ = 1;
+        node->size_ = 1;
+        LinkNode(node, parent, to_left);
+        nh.node_ = nullptr;
+        nh.pool_.reset();
+        nh.foreign_pools_.clear();
+        return std::make_pair(node, true);
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    void BinaryTree<Key, Value, KeyOfValue, Compare>::EraseRange(BinaryTree::Node *first, BinaryTree::Node *last) {
+        size_type count = RankOf(last) - RankOf(first);
+        size_type levels = 1;
+        for (size_type n = size_; n > 1; n >>= 1) {
+            ++levels;
+        }
+        if (count * levels < size_) {
+            // короткий диапазон: каждый узел удаляется по указателю, без нового спуска от корня
+            Iterator it(first);
+            while (it.it_node_ != last) {
+                Node *node = it.it_node_;
+                ++it;
+                DeleteNode(node);
+            }
+            return;
+        }
+        Node *node = TreeToList(root_);
+        Node *head = nullptr;
+        Node *tail = nullptr;
+        bool erasing = false;
+        while (node != nullptr) {
+            Node *next = node->right_;
+            if (node == first) {
+                erasing = true;
+            } else if (node == last) {
+                erasing = false;
+            }
+            if (erasing) {
+                Pool().Destroy(node);
+            } else {
+                PushBack(head, tail, node);
+            }
+            node = next;
+        }
+        size_ -= count;
+        root_ = BuildFromList(head, size_);
+        UpdateHeader();
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    template<typename Pred>
+    typename BinaryTree<Key, Value, KeyOfValue, Compare>::size_type BinaryTree<Key, Value, KeyOfValue, Compare>::RemoveIf(Pred pred) {
+        Node *node = TreeToList(root_);
+        Node *head = nullptr;
+        Node *tail = nullptr;
+        size_type kept = 0;
+        // если предикат бросит исключение, непройденная часть списка все равно возвращается в дерево
+        try {
+            while (node != nullptr) {
+                Node *next = node->right_;
+                if (pred(node->value_)) {
+                    Pool().Destroy(node);
                 } else {
-                    node = node_left;
+                    PushBack(head, tail, node);
+                    ++kept;
                 }
-                if (node != nullptr) node->parent_ = node_parent;
+                node = next;
+            }
+        } catch (...) {
+            if (tail == nullptr) {
+                head = node;
             } else {
-                Node *min_in_right = GetMin(node->right_);
-                node->key_ = min_in_right->key_;
-                node->value_ = min_in_right->value_;
-                node->right_ = RecursiveDelete(node->right_, min_in_right->key_);
+                tail->right_ = node;
+            }
+            for (; node != nullptr; node = node->right_) {
+                ++kept;
             }
+            root_ = BuildFromList(head, kept);
+            size_ = kept;
+            UpdateHeader();
+            throw;
+        }
+        size_type removed = size_ - kept;
+        root_ = BuildFromList(head, kept);
+        size_ = kept;
+        UpdateHeader();
+        return removed;
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    typename BinaryTree<Key, Value, KeyOfValue, Compare>::size_type BinaryTree<Key, Value, KeyOfValue, Compare>::RankOf(const BinaryTree::Node *node) const {
+        if (node == nullptr) {
+            return size_;
+        }
+        size_type rank = GetSize(node->left_);
+        while (node->parent_ != nullptr) {
+            if (node == node->parent_->right_) {
+                rank += GetSize(node->parent_->left_) + 1;
+            }
+            node = node->parent_;
+        }
+        return rank;
+    }
+
+template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    void BinaryTree<Key, Value, KeyOfValue, Compare>::ReplaceChild(BinaryTree::Node *node, BinaryTree::Node *child) {
+        Node *parent = node->parent_;
+        if (child != nullptr) {
+            child->parent_ = parent;
         }
+        if (parent == nullptr) {
+            root_ = child;
+        } else if (parent->left_ == node) {
+            parent->left_ = child;
+        } else {
+            parent->right_ = child;
+        }
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    void BinaryTree<Key, Value, KeyOfValue, Compare>::RebalanceUp(BinaryTree::Node *node) {
         if (node != nullptr) {
-//            SetHeight(node);
-//            Balance(node);
+            root_ = BalanceToRoot(node);
+        }
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    typename BinaryTree<Key, Value, KeyOfValue, Compare>::Node *BinaryTree<Key, Value, KeyOfValue, Compare>::BalanceToRoot(BinaryTree::Node *node) {
+        // размеры поддеревьев меняются на всем пути до корня, поэтому идем до самого верха
+        Node *root = node;
+        while (node != nullptr) {
+            Node *parent = node->parent_;
+            bool is_left = parent != nullptr && parent->left_ == node;
+            Node *subtree = Balance(node);
+            if (parent == nullptr) {
+                root = subtree;
+            } else if (is_left) {
+                parent->left_ = subtree;
+            } else {
+                parent->right_ = subtree;
+            }
+            node = parent;
+        }
+        return root;
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    typename BinaryTree<Key, Value, KeyOfValue, Compare>::Node *BinaryTree<Key, Value, KeyOfValue, Compare>::JoinNodes(BinaryTree::Node *left,
+                                                                                           BinaryTree::Node *mid,
+                                                                                           BinaryTree::Node *right) {
+        int left_height = GetHeight(left);
+        int right_height = GetHeight(right);
+        // mid подвешивается к краю более высокого дерева там, где высоты уже почти равны, дальше обычная балансировка
+        Node *parent = nullptr;
+        bool to_left = false;
+        if (left_height > right_height + 1) {
+            while (GetHeight(left) > right_height + 1) {
+                parent = left;
+                left = left->right_;
+            }
+        } else if (right_height > left_height + 1) {
+            to_left = true;
+            while (GetHeight(right) > left_height + 1) {
+                parent = right;
+                right = right->left_;
+            }
+        }
+        mid->left_ = left;
+        mid->right_ = right;
+        if (left != nullptr) left->parent_ = mid;
+        if (right != nullptr) right->parent_ = mid;
+        mid->parent_ = parent;
+        UpdateNode(mid);
+        if (parent == nullptr) {
+            return mid;
+        }
+        if (to_left) {
+            parent->left_ = mid;
+        } else {
+            parent->right_ = mid;
+        }
+        return BalanceToRoot(parent);
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    typename BinaryTree<Key, Value, KeyOfValue, Compare>::Node *BinaryTree<Key, Value, KeyOfValue, Compare>::JoinNodes(BinaryTree::Node *left,
+                                                                                           BinaryTree::Node *right) {
+        if (left == nullptr) {
+            return right;
+        }
+        if (right == nullptr) {
+            return left;
+        }
+        // средним узлом становится максимум left
+        Node *max = GetMax(left);
+        Node *parent = max->parent_;
+        if (max->left_ != nullptr) {
+            max->left_->parent_ = parent;
+        }
+        if (parent == nullptr) {
+            left = max->left_;
+        } else {
+            parent->right_ = max->left_;
+            left = BalanceToRoot(parent);
+        }
+        return JoinNodes(left, max, right);
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    template<typename K>
+    void BinaryTree<Key, Value, KeyOfValue, Compare>::SplitNodes(BinaryTree::Node *node, const K &key, BinaryTree::Node *&left,
+                                                                BinaryTree::Node *&found, BinaryTree::Node *&right) const {
+        if (node == nullptr) {
+            left = nullptr;
+            found = nullptr;
+            right = nullptr;
+            return;
+        }
+        Node *node_left = node->left_;
+        Node *node_right = node->right_;
+        if (node_left != nullptr) node_left->parent_ = nullptr;
+        if (node_right != nullptr) node_right->parent_ = nullptr;
+        // высоты собираемых частей растут вместе с глубиной возврата, поэтому все join-ы вместе стоят O(log n)
+        if (comp_(key, KeyOf(node))) {
+            Node *greater = nullptr;
+            SplitNodes(node_left, key, left, found, greater);
+            right = JoinNodes(greater, node, node_right);
+        } else if (comp_(KeyOf(node), key)) {
+            Node *less = nullptr;
+            SplitNodes(node_right, key, less, found, right);
+            left = JoinNodes(node_left, node, less);
+        } else {
+            left = node_left;
+            found = node;
+            right = node_right;
+        }
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    typename BinaryTree<Key, Value, KeyOfValue, Compare>::Node *BinaryTree<Key, Value, KeyOfValue, Compare>::UnionNodes(BinaryTree::Node *lhs,
+                                                                                            BinaryTree::Node *rhs) {
+        if (lhs == nullptr) {
+            return rhs;
+        }
+        if (rhs == nullptr) {
+            return lhs;
+        }
+        Node *lhs_left = lhs->left_;
+        Node *lhs_right = lhs->right_;
+        if (lhs_left != nullptr) lhs_left->parent_ = nullptr;
+        if (lhs_right != nullptr) lhs_right->parent_ = nullptr;
+        Node *rhs_left = nullptr;
+        Node *found = nullptr;
+        Node *rhs_right = nullptr;
+        SplitNodes(rhs, KeyOf(lhs), rhs_left, found, rhs_right);
+        if (found != nullptr) {
+            Pool().Destroy(found);
+        }
+        Node *left = UnionNodes(lhs_left, rhs_left);
+        Node *right = UnionNodes(lhs_right, rhs_right);
+        return JoinNodes(left, lhs, right);
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    typename BinaryTree<Key, Value, KeyOfValue, Compare>::Node *BinaryTree<Key, Value, KeyOfValue, Compare>::DifferenceNodes(BinaryTree::Node *lhs,
+                                                                                                 const BinaryTree::Node *rhs) {
+        if (lhs == nullptr || rhs == nullptr) {
+            return lhs;
+        }
+        Node *left = nullptr;
+        Node *found = nullptr;
+        Node *right = nullptr;
+        SplitNodes(lhs, KeyOf(rhs), left, found, right);
+        if (found != nullptr) {
+            Pool().Destroy(found);
+        }
+        left = DifferenceNodes(left, rhs->left_);
+        right = DifferenceNodes(right, rhs->right_);
+        return JoinNodes(left, right);
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    void BinaryTree<Key, Value, KeyOfValue, Compare>::UnionWith(BinaryTree &other) {
+        if (this == &other) {
+            return;
+        }
+        AdoptPools(other);
+        root_ = UnionNodes(root_, other.root_);
+        size_ = GetSize(root_);
+        UpdateHeader();
+        other.root_ = nullptr;
+        other.size_ = 0;
+        other.header_ = Header();
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    void BinaryTree<Key, Value, KeyOfValue, Compare>::Subtract(const BinaryTree &other) {
+        if (this == &other) {
+            clear();
+            return;
+        }
+        root_ = DifferenceNodes(root_, other.root_);
+        size_ = GetSize(root_);
+        UpdateHeader();
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    void BinaryTree<Key, Value, KeyOfValue, Compare>::AssignIntersection(const BinaryTree &lhs, const BinaryTree &rhs) {
+        clear();
+        comp_ = lhs.comp_;
+        // идем по меньшему дереву, а в большем ищем от предыдущей найденной позиции: соседние ключи близко,
+        // поэтому поиски вместе стоят O(m log(n/m + 1)), а не O(m log n)
+        bool lhs_smaller = lhs.size_ <= rhs.size_;
+        const BinaryTree &smaller = lhs_smaller ? lhs : rhs;
+        const BinaryTree &larger = lhs_smaller ? rhs : lhs;
+        Node *head = nullptr;
+        Node *tail = nullptr;
+        size_type count = 0;
+        Node *finger = nullptr;
+        try {
+            for (Iterator it(smaller.header_.leftmost_); it.it_node_ != nullptr; ++it) {
+                const Key &key = KeyOf(it.it_node_);
+                finger = finger == nullptr ? larger.LowerBoundNode(key) : larger.LowerBoundFrom(finger, key);
+                if (finger == nullptr) {
+                    break;
+                }
+                if (!comp_(key, KeyOf(finger))) {
+                    Node *node = Pool().Create(nullptr, (lhs_smaller ? it.it_node_ : finger)->value_);
+                    PushBack(head, tail, node);
+                    ++count;
+                }
+            }
+        } catch (...) {
+            DestroyList(head);
+            throw;
+        }
+        root_ = BuildFromList(head, count);
+        size_ = count;
+        UpdateHeader();
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    template<typename K>
+    typename BinaryTree<Key, Value, KeyOfValue, Compare>::Node *BinaryTree<Key, Value, KeyOfValue, Compare>::LowerBoundFrom(BinaryTree::Node *finger,
+                                                                                                const K &key) const {
+        if (!comp_(KeyOf(finger), key)) {
+            return finger;
+        }
+        // все узлы до finger меньше key; поднимаемся, пока ответ не окажется в поддереве node
+        // или не станет родителем, от которого node - левый сын
+        Node *node = finger;
+        Node *result = nullptr;
+        while (node->parent_ != nullptr) {
+            Node *parent = node->parent_;
+            if (parent->left_ == node && !comp_(KeyOf(parent), key)) {
+                result = parent;
+                break;
+            }
+            node = parent;
+        }
+        while (node != nullptr) {
+            if (!comp_(KeyOf(node), key)) {
+                result = node;
+                node = node->left_;
+            } else {
+                node = node->right_;
+            }
+        }
+        return result;
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    int BinaryTree<Key, Value, KeyOfValue, Compare>::GetHeight(BinaryTree::Node *node) {
+        return node == nullptr ? 0 : node->height_;
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    int BinaryTree<Key, Value, KeyOfValue, Compare>::GetBalanceFactor(BinaryTree::Node *node) {
+        return GetHeight(node->right_) - GetHeight(node->left_);
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    size_t BinaryTree<Key, Value, KeyOfValue, Compare>::GetSize(BinaryTree::Node *node) {
+        return node == nullptr ? 0 : node->size_;
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    void BinaryTree<Key, Value, KeyOfValue, Compare>::UpdateNode(BinaryTree::Node *node) {
+        node->height_ = std::max(GetHeight(node->left_), GetHeight(node->right_)) + 1;
+        node->size_ = GetSize(node->left_) + GetSize(node->right_) + 1;
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    typename BinaryTree<Key, Value, KeyOfValue, Compare>::Node *BinaryTree<Key, Value, KeyOfValue, Compare>::RotateLeft(BinaryTree::Node *node) {
+        Node *pivot = node->right_;
+        node->right_ = pivot->left_;
+        if (node->right_ != nullptr) node->right_->parent_ = node;
+        pivot->left_ = node;
+        pivot->parent_ = node->parent_;
+        node->parent_ = pivot;
+        UpdateNode(node);
+        UpdateNode(pivot);
+        return pivot;
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    typename BinaryTree<Key, Value, KeyOfValue, Compare>::Node *BinaryTree<Key, Value, KeyOfValue, Compare>::RotateRight(BinaryTree::Node *node) {
+        Node *pivot = node->left_;
+        node->left_ = pivot->right_;
+        if (node->left_ != nullptr) node->left_->parent_ = node;
+        pivot->right_ = node;
+        pivot->parent_ = node->parent_;
+        node->parent_ = pivot;
+        UpdateNode(node);
+        UpdateNode(pivot);
+        return pivot;
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    typename BinaryTree<Key, Value, KeyOfValue, Compare>::Node *BinaryTree<Key, Value, KeyOfValue, Compare>::Balance(BinaryTree::Node *node) {
+        UpdateNode(node);
+        int balance = GetBalanceFactor(node);
+        if (balance > 1) {
+            if (GetBalanceFactor(node->right_) < 0) {
+                node->right_ = RotateRight(node->right_);
+            }
+            return RotateLeft(node);
+        }
+        if (balance < -1) {
+            if (GetBalanceFactor(node->left_) > 0) {
+                node->left_ = RotateLeft(node->left_);
+            }
+            return RotateRight(node);
         }
         return node;
     }
 
-    template<typename Key, typename Value>
-    typename BinaryTree<Key, Value>::Node *BinaryTree<Key, Value>::Iterator::MoveForward(BinaryTree::Node *node) {
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    typename BinaryTree<Key, Value, KeyOfValue, Compare>::Node *BinaryTree<Key, Value, KeyOfValue, Compare>::Iterator::MoveForward(BinaryTree::Node *node) {
         if (node->right_ != nullptr) {
             return GetMin(node->right_);
         }
@@ -444,8 +1797,8 @@ template<typename Key, typename Value>
         return parent;
     }
 
-    template<typename Key, typename Value>
-    typename BinaryTree<Key, Value>::Node *BinaryTree<Key, Value>::Iterator::MoveBack(BinaryTree::Node *node) {
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    typename BinaryTree<Key, Value, KeyOfValue, Compare>::Node *BinaryTree<Key, Value, KeyOfValue, Compare>::Iterator::MoveBack(BinaryTree::Node *node) {
         if (node->left_ != nullptr) {
             return GetMax(node->left_);
         }
@@ -457,14 +1810,5 @@ template<typename Key, typename Value>
         return parent;
     }
 
-    template<typename Key, typename Value>
-    size_t BinaryTree<Key, Value>::RecursiveSize(BinaryTree::Node *node) {
-        if (node == nullptr) return 0;
-        size_t left_size = RecursiveSize(node->left_);
-        size_t right_size = RecursiveSize(node->right_);
-        return 1 + left_size + right_size;
-    }
-
-
 } // namespace s21
 #endif //SRC_BINARYTREE_H
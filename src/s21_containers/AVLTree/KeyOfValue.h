@@ -0,0 +1,19 @@
+#ifndef SRC_KEYOFVALUE_H
+#define SRC_KEYOFVALUE_H
+
+// KeyOfValue достает ключ из значения, которое хранит дерево: set хранит сам ключ,
+// а map - пару ключ-значение (без отдельной копии ключа). Функтор выбирает контейнер.
+
+namespace s21 {
+    template<typename Value>
+    struct IdentityKey {
+        const Value &operator()(const Value &value) const { return value; }
+    };
+
+    template<typename Pair>
+    struct PairFirstKey {
+        const typename Pair::first_type &operator()(const Pair &pair) const { return pair.first; }
+    };
+} // namespace s21
+
+#endif //SRC_KEYOFVALUE_H
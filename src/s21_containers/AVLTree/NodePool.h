@@ -0,0 +1,162 @@
+#ifndef SRC_NODEPOOL_H
+#define SRC_NODEPOOL_H
+
+#include <algorithm>
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+// NodePool - slab-аллокатор для узлов дерева.
+// Память берется у системы чанками (каждый чанк выровнен по кэш-линии), освобожденные узлы
+// попадают в free list и переиспользуются, а все чанки разом возвращаются системе в Release().
+// Если определить S21_NODE_POOL_DISABLE, каждый узел создается обычным new/delete
+// (так бенчмарк сравнивает пул со старым путем).
+
+namespace s21 {
+    template<typename T>
+    class NodePool {
+    public:
+        using size_type = std::size_t;
+
+#ifdef S21_NODE_POOL_DISABLE
+        static constexpr bool kTrivialRelease = false;
+#else
+        // true if Release() may be called without destroying the live nodes first
+        static constexpr bool kTrivialRelease = std::is_trivially_destructible<T>::value;
+#endif
+
+        NodePool() noexcept = default;
+        NodePool(const NodePool &other) = delete;
+        NodePool(NodePool &&other) noexcept;
+        NodePool &operator=(const NodePool &other) = delete;
+        NodePool &operator=(NodePool &&other) noexcept;
+        ~NodePool();
+
+        template<typename... Args>
+        T *Create(Args &&...args); // constructs a node in a free slot
+        void Destroy(T *node); // destroys the node and puts its slot to the free list
+        void Release(); // returns all chunks to the system (live nodes must be destroyed before unless kTrivialRelease)
+        void swap(NodePool &other) noexcept;
+
+    private:
+        union Slot {
+            Slot *next_;
+            alignas(T) unsigned char storage_[sizeof(T)];
+        };
+
+        struct Chunk {
+            Chunk *next_;
+            size_type capacity_;
+        };
+
+        static constexpr size_type kCacheLine = 64;
+        static constexpr size_type kHeaderSize = (sizeof(Chunk) + kCacheLine - 1) / kCacheLine * kCacheLine;
+        static constexpr size_type kFirstChunkSlots = 16;
+        static constexpr size_type kMaxChunkSlots = std::max<size_type>(kFirstChunkSlots, (64 * 1024) / sizeof(Slot));
+
+        Slot *AllocateSlot();
+        void AddChunk();
+
+        Chunk *chunks_ = nullptr;
+        Slot *free_list_ = nullptr;
+        Slot *next_slot_ = nullptr; // first never used slot of the newest chunk
+        Slot *chunk_end_ = nullptr;
+    };
+
+    template<typename T>
+    NodePool<T>::NodePool(NodePool &&other) noexcept {
+        swap(other);
+    }
+
+    template<typename T>
+    NodePool<T> &NodePool<T>::operator=(NodePool &&other) noexcept {
+        if (this != &other) {
+            Release();
+            swap(other);
+        }
+        return *this;
+    }
+
+    template<typename T>
+    NodePool<T>::~NodePool() {
+        Release();
+    }
+
+    template<typename T>
+    template<typename... Args>
+    T *NodePool<T>::Create(Args &&...args) {
+#ifdef S21_NODE_POOL_DISABLE
+        return new T(std::forward<Args>(args)...);
+#else
+        Slot *slot = AllocateSlot();
+        try {
+            return ::new (static_cast<void *>(slot->storage_)) T(std::forward<Args>(args)...);
+        } catch (...) {
+            slot->next_ = free_list_;
+            free_list_ = slot;
+            throw;
+        }
+#endif
+    }
+
+    template<typename T>
+    void NodePool<T>::Destroy(T *node) {
+#ifdef S21_NODE_POOL_DISABLE
+        delete node;
+#else
+        node->~T();
+        Slot *slot = reinterpret_cast<Slot *>(node);
+        slot->next_ = free_list_;
+        free_list_ = slot;
+#endif
+    }
+
+    template<typename T>
+    void NodePool<T>::Release() {
+        while (chunks_ != nullptr) {
+            Chunk *next = chunks_->next_;
+            ::operator delete(static_cast<void *>(chunks_), std::align_val_t(kCacheLine));
+            chunks_ = next;
+        }
+        free_list_ = nullptr;
+        next_slot_ = nullptr;
+        chunk_end_ = nullptr;
+    }
+
+    template<typename T>
+    void NodePool<T>::swap(NodePool &other) noexcept {
+        std::swap(chunks_, other.chunks_);
+        std::swap(free_list_, other.free_list_);
+        std::swap(next_slot_, other.next_slot_);
+        std::swap(chunk_end_, other.chunk_end_);
+    }
+
+    template<typename T>
+    typename NodePool<T>::Slot *NodePool<T>::AllocateSlot() {
+        if (free_list_ != nullptr) {
+            Slot *slot = free_list_;
+            free_list_ = slot->next_;
+            return slot;
+        }
+        if (next_slot_ == chunk_end_) {
+            AddChunk();
+        }
+        return next_slot_++;
+    }
+
+    template<typename T>
+    void NodePool<T>::AddChunk() {
+        // каждый следующий чанк в два раза больше предыдущего, чтобы маленькие деревья не занимали лишнего
+        size_type capacity = chunks_ == nullptr ? kFirstChunkSlots : std::min(chunks_->capacity_ * 2, kMaxChunkSlots);
+        void *memory = ::operator new(kHeaderSize + capacity * sizeof(Slot), std::align_val_t(kCacheLine));
+        Chunk *chunk = static_cast<Chunk *>(memory);
+        chunk->next_ = chunks_;
+        chunk->capacity_ = capacity;
+        chunks_ = chunk;
+        next_slot_ = reinterpret_cast<Slot *>(static_cast<unsigned char *>(memory) + kHeaderSize);
+        chunk_end_ = next_slot_ + capacity;
+    }
+
+} // namespace s21
+#endif //SRC_NODEPOOL_H
@@ -1,14 +1,25 @@
 #ifndef SRC_S21_MAP_H
 #define SRC_S21_MAP_H
 
+#include <tuple>
+#include <vector>
+
 #include "../AVLTree/BinaryTree.h"
 
 namespace s21 {
-    template <typename Key, typename T>
-    class map : public BinaryTree<Key, T> {
+    // снимок для freeze() (s21_containersplus): нужен целиком только там, где freeze() вызывают
+    template <typename Key, typename T, typename Compare>
+    class frozen_map;
+
+    template <typename Key, typename T, typename Compare = std::less<Key>>
+    class map : public BinaryTree<Key, std::pair<const Key, T>, PairFirstKey<std::pair<const Key, T>>, Compare> {
+        // узел хранит пару целиком, поэтому итератор отдает ссылку на нее, а не собранную копию
+        using tree_type = BinaryTree<Key, std::pair<const Key, T>, PairFirstKey<std::pair<const Key, T>>, Compare>;
+
     public:
         class MapIterator;
         class ConstMapIterator;
+        class MapNodeHandle;
 
         using key_type = Key;
         using mapped_type = T;
@@ -18,11 +29,16 @@ namespace s21 {
         using iterator = MapIterator;
         using const_iterator = ConstMapIterator;
         using size_type = size_t;
+        using node_type = MapNodeHandle;
+        using insert_return_type = typename tree_type::template InsertReturn<iterator, node_type>;
 
-        map() : BinaryTree<Key, T>(){};
+        map() : tree_type(){};
         map(std::initializer_list<value_type> const &items);
-        map(const map &other) : BinaryTree<Key, T>(other){};
-        map(map &&other) noexcept : BinaryTree<Key, T>(std::move(other)){};
+        // builds the map in O(n) if [first, last) is sorted by key, otherwise sorts it first
+        template <typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category>
+        map(InputIt first, InputIt last);
+        map(const map &other) : tree_type(other){};
+        map(map &&other) noexcept : tree_type(std::move(other)){};
         map &operator=(map &&other) noexcept;
         map &operator=(const map &other);
         ~map() = default;
@@ -32,17 +48,33 @@ namespace s21 {
         const_iterator cbegin() const;
         const_iterator cend() const;
         void merge(map &other);
+        // immutable copy with a faster search; needs s21_containersplus/frozen_map/s21_frozen_map.h where it is called
+        frozen_map<Key, T, Compare> freeze() const { return frozen_map<Key, T, Compare>(cbegin(), cend(), this->comp_); };
         // TODO: contains доделать (DONE)
         bool contains(const Key& key); // checks if there is an element with key equivalent to key in the container
-
-        class MapIterator : public BinaryTree<Key, T>::Iterator {
+        template <typename K, typename C = Compare, typename = typename C::is_transparent>
+        bool contains(const K &key);
+        iterator find(const Key &key);
+        template <typename K, typename C = Compare, typename = typename C::is_transparent>
+        iterator find(const K &key);
+        iterator find_by_order(size_type k); // returns iterator to the k-th smallest element (from 0) or end()
+        iterator lower_bound(const Key &key); // returns iterator to the first element not less than key or end()
+        template <typename K, typename C = Compare, typename = typename C::is_transparent>
+        iterator lower_bound(const K &key);
+        iterator upper_bound(const Key &key); // returns iterator to the first element greater than key or end()
+        template <typename K, typename C = Compare, typename = typename C::is_transparent>
+        iterator upper_bound(const K &key);
+        std::pair<iterator, iterator> equal_range(const Key &key); // returns the range of elements with key
+        template <typename K, typename C = Compare, typename = typename C::is_transparent>
+        std::pair<iterator, iterator> equal_range(const K &key);
+
+        class MapIterator : public tree_type::Iterator {
         public:
             friend class map;
-            MapIterator() : BinaryTree<Key, T>::Iterator(){};
-            MapIterator(typename BinaryTree<Key, T>::Node *node,
-                        typename BinaryTree<Key, T>::Node *past_node = nullptr)
-                        : BinaryTree<Key, T>::Iterator(node, past_node = nullptr) {};
-            value_type operator*();
+            MapIterator() : tree_type::Iterator(){};
+            MapIterator(typename tree_type::Node *node,
+                        const typename tree_type::Header *header = nullptr)
+                        : tree_type::Iterator(node, header) {};
 
         protected:
             T &return_value();
@@ -52,128 +84,211 @@ namespace s21 {
         public:
             friend class map;
             ConstMapIterator() : MapIterator() {};
-            ConstMapIterator(typename BinaryTree<Key, T>::Node *node,
-                             typename BinaryTree<Key, T>::Node *past_node = nullptr)
-                    : MapIterator(node, past_node = nullptr) {};
+            ConstMapIterator(typename tree_type::Node *node,
+                             const typename tree_type::Header *header = nullptr)
+                    : MapIterator(node, header) {};
             const_reference operator*() const { return MapIterator::operator*(); };
+            const value_type *operator->() const { return MapIterator::operator->(); };
+        };
+
+        // node handle of map: value() is the whole pair, mapped() is its value part
+        class MapNodeHandle : public tree_type::NodeHandle {
+        public:
+            MapNodeHandle() = default;
+            MapNodeHandle(typename tree_type::NodeHandle &&nh) noexcept : tree_type::NodeHandle(std::move(nh)) {};
+            mapped_type &mapped() const { return this->node_->value_.second; };
         };
 
         T &at(const Key &key);
+        template <typename K, typename C = Compare, typename = typename C::is_transparent>
+        T &at(const K &key);
         T &operator[](const Key &key);
         // inserts node and returns iterator to where the element is in the container and bool denoting whether the insertion took place
         std::pair<iterator, bool> insert(const value_type &value);
+        std::pair<iterator, bool> insert(value_type &&value);
         // inserts value by key and returns iterator to where the element is in the container and bool denoting whether the insertion took place
         std::pair<iterator, bool> insert(const Key &key, const T &obj);
+        // inserts value as close as possible to just before hint and returns iterator to the element with its key;
+        // a hint next to the right place (end() for ascending keys) spares the search from the root
+        iterator insert(iterator hint, const value_type &value);
+        iterator insert(iterator hint, value_type &&value);
         // inserts an element or assigns to the current element if the key already exists
         std::pair<iterator, bool> insert_or_assign(const Key &key, const T &obj);
+        // inserts an element built in place from args (a key and a value, or a pair of them)
+        template <class... Args>
+        std::pair<iterator, bool> emplace(Args &&...args);
+        // builds the value in place from args if there is no element with key, otherwise does nothing
+        template <class... Args>
+        std::pair<iterator, bool> try_emplace(const Key &key, Args &&...args);
+        template <class... Args>
+        std::pair<iterator, bool> try_emplace(Key &&key, Args &&...args);
         template <class... Args>
         std::vector<std::pair<iterator, bool>> insert_many(Args &&...args);
+        // emplace with a hint, see insert(hint, value)
+        template <class... Args>
+        iterator emplace_hint(iterator hint, Args &&...args);
+        // the same as for set: the node moves between maps without copying the key and the value
+        node_type extract(iterator pos) { return tree_type::ExtractNode(pos.it_node_); };
+        node_type extract(const Key &key);
+        insert_return_type insert(node_type &&nh);
+        iterator insert(iterator hint, node_type &&nh);
         void erase(iterator pos);
+        iterator erase(iterator first, iterator last); // erases [first, last) and returns last
+
+        // erases every element the predicate holds for and returns how many were erased
+        template <typename K, typename V, typename C, typename Pred>
+        friend typename map<K, V, C>::size_type erase_if(map<K, V, C> &container, Pred pred);
 
     private:
-        iterator find(const Key &key);
+        iterator MakeIterator(typename tree_type::Node *node); // iterator to node, end() for nullptr
+        template <typename K, typename V>
+        std::pair<iterator, bool> EmplacePair(K &&key, V &&obj);
+        template <typename P>
+        std::pair<iterator, bool> EmplacePair(P &&pair);
     };
 
-    template <typename Key, typename T>
-    map<Key, T>::map(const std::initializer_list<value_type> &items) {
-        for (auto i = items.begin(); i != items.end(); ++i) {
-            insert(*i);
-        }
+    template <typename Key, typename T, typename Compare>
+    map<Key, T, Compare>::map(const std::initializer_list<value_type> &items) {
+        tree_type::assign_sorted(items.begin(), items.end());
     }
 
-    template <typename Key, typename T>
-    map<Key, T> &map<Key, T>::operator=(map &&other) noexcept {
+    template <typename Key, typename T, typename Compare>
+    template <typename InputIt, typename>
+    map<Key, T, Compare>::map(InputIt first, InputIt last) {
+        tree_type::assign_sorted(first, last);
+    }
+
+    template <typename Key, typename T, typename Compare>
+    map<Key, T, Compare> &map<Key, T, Compare>::operator=(map &&other) noexcept {
         if (this != &other) {
-            BinaryTree<Key, T>::operator=(std::move(other));
+            tree_type::operator=(std::move(other));
         }
         return *this;
     }
 
-    template <typename Key, typename T>
-    map<Key, T> &map<Key, T>::operator=(const map &other) {
+    template <typename Key, typename T, typename Compare>
+    map<Key, T, Compare> &map<Key, T, Compare>::operator=(const map &other) {
         if (this != &other) {
-            BinaryTree<Key, T>::operator=(other);
+            tree_type::operator=(other);
         }
         return *this;
     }
 
-    template <typename Key, typename T>
-    std::pair<typename map<Key, T>::iterator, bool> map<Key, T>::insert(const value_type &value) {
+    template <typename Key, typename T, typename Compare>
+    std::pair<typename map<Key, T, Compare>::iterator, bool> map<Key, T, Compare>::insert(const value_type &value) {
         return insert(value.first, value.second);
     }
 
-    template <typename Key, typename T>
-    std::pair<typename map<Key, T>::iterator, bool> map<Key, T>::insert(const Key &key, const T &obj) {
-        std::pair<iterator, bool> return_value;
-        if (BinaryTree<Key, T>::root_ == nullptr) {
-            BinaryTree<Key, T>::root_ = new typename BinaryTree<Key, T>::Node(key, obj);
-            return_value.first = iterator(BinaryTree<Key, T>::root_);
-            return_value.second = true;
-        } else {
-            bool check_insert = BinaryTree<Key, T>::RecursiveInsert(BinaryTree<Key, T>::root_, key, obj);
-            return_value.first = find(key);
-            return_value.second = check_insert;
-        }
-        return return_value;
+    template <typename Key, typename T, typename Compare>
+    std::pair<typename map<Key, T, Compare>::iterator, bool> map<Key, T, Compare>::insert(value_type &&value) {
+        return try_emplace(value.first, std::move(value.second));
     }
 
-    template <typename Key, typename T>
-//    typename map<Key, T>::MapIterator::operator*() const {
-    typename map<Key, T>::value_type map<Key, T>::MapIterator::operator*() {
-        if (BinaryTree<Key, T>::Iterator::it_node_ == nullptr) {
-            static value_type not_true_value{};
-            return not_true_value;
+    template <typename Key, typename T, typename Compare>
+    std::pair<typename map<Key, T, Compare>::iterator, bool> map<Key, T, Compare>::insert(const Key &key, const T &obj) {
+        return try_emplace(key, obj);
+    }
+
+    template <typename Key, typename T, typename Compare>
+    typename map<Key, T, Compare>::iterator map<Key, T, Compare>::insert(iterator hint, const value_type &value) {
+        return MakeIterator(tree_type::EmplaceHintUnique(hint.it_node_, value.first, value).first);
+    }
+
+    template <typename Key, typename T, typename Compare>
+    typename map<Key, T, Compare>::iterator map<Key, T, Compare>::insert(iterator hint, value_type &&value) {
+        return MakeIterator(tree_type::EmplaceHintUnique(hint.it_node_, value.first, std::move(value)).first);
+    }
+
+    template <typename Key, typename T, typename Compare>
+    template <class... Args>
+    typename map<Key, T, Compare>::iterator map<Key, T, Compare>::emplace_hint(iterator hint, Args &&...args) {
+        // ключ нужен до поиска места, поэтому пара собирается заранее и переносится в узел
+        value_type value(std::forward<Args>(args)...);
+        return insert(hint, std::move(value));
+    }
+
+    template <typename Key, typename T, typename Compare>
+    template <class... Args>
+    std::pair<typename map<Key, T, Compare>::iterator, bool> map<Key, T, Compare>::emplace(Args &&...args) {
+        return EmplacePair(std::forward<Args>(args)...);
+    }
+
+    template <typename Key, typename T, typename Compare>
+    template <class... Args>
+    std::pair<typename map<Key, T, Compare>::iterator, bool> map<Key, T, Compare>::try_emplace(const Key &key,
+                                                                                              Args &&...args) {
+        auto result = tree_type::EmplaceUnique(key, std::piecewise_construct, std::forward_as_tuple(key),
+                                               std::forward_as_tuple(std::forward<Args>(args)...));
+        return std::pair<iterator, bool>(MakeIterator(result.first), result.second);
+    }
+
+    template <typename Key, typename T, typename Compare>
+    template <class... Args>
+    std::pair<typename map<Key, T, Compare>::iterator, bool> map<Key, T, Compare>::try_emplace(Key &&key,
+                                                                                              Args &&...args) {
+        auto result = tree_type::EmplaceUnique(key, std::piecewise_construct, std::forward_as_tuple(std::move(key)),
+                                               std::forward_as_tuple(std::forward<Args>(args)...));
+        return std::pair<iterator, bool>(MakeIterator(result.first), result.second);
+    }
+
+    template <typename Key, typename T, typename Compare>
+    template <typename K, typename V>
+    std::pair<typename map<Key, T, Compare>::iterator, bool> map<Key, T, Compare>::EmplacePair(K &&key, V &&obj) {
+        if constexpr (std::is_same<typename std::decay<K>::type, Key>::value) {
+            return try_emplace(std::forward<K>(key), std::forward<V>(obj));
+        } else {
+            return try_emplace(Key(std::forward<K>(key)), std::forward<V>(obj));
         }
-        std::pair<const key_type, mapped_type> pr =
-                std::make_pair(BinaryTree<Key, T>::Iterator::it_node_->key_,
-                               BinaryTree<Key, T>::Iterator::it_node_->value_);
-        std::pair<const key_type, mapped_type> ref = pr;
+    }
 
-        return ref;
+    template <typename Key, typename T, typename Compare>
+    template <typename P>
+    std::pair<typename map<Key, T, Compare>::iterator, bool> map<Key, T, Compare>::EmplacePair(P &&pair) {
+        return EmplacePair(std::forward<P>(pair).first, std::forward<P>(pair).second);
     }
 
-    template <typename Key, typename T>
-    T &map<Key, T>::MapIterator::return_value() {
-        if (BinaryTree<Key, T>::Iterator::it_node_ == nullptr) {
+    template <typename Key, typename T, typename Compare>
+    T &map<Key, T, Compare>::MapIterator::return_value() {
+        if (tree_type::Iterator::it_node_ == nullptr) {
             static T not_true_value{};
             return not_true_value;
         }
-        return BinaryTree<Key, T>::Iterator::it_node_->value_;
+        return tree_type::Iterator::it_node_->value_.second;
     }
 
-    template <typename Key, typename T>
-    typename map<Key, T>::iterator map<Key, T>::find(const Key &key) {
-        typename BinaryTree<Key, T>::Node *node =
-                BinaryTree<Key, T>::RecursiveFind(BinaryTree<Key, T>::root_, key);
-        return iterator(node);
+    template <typename Key, typename T, typename Compare>
+    typename map<Key, T, Compare>::iterator map<Key, T, Compare>::find(const Key &key) {
+        return MakeIterator(tree_type::FindNode(key));
     }
 
-    template <typename Key, typename T>
-    std::pair<typename map<Key, T>::iterator, bool> map<Key, T>::insert_or_assign(
+    template <typename Key, typename T, typename Compare>
+    template <typename K, typename C, typename>
+    typename map<Key, T, Compare>::iterator map<Key, T, Compare>::find(const K &key) {
+        return MakeIterator(tree_type::FindNode(key));
+    }
+
+    template <typename Key, typename T, typename Compare>
+    std::pair<typename map<Key, T, Compare>::iterator, bool> map<Key, T, Compare>::insert_or_assign(
             const Key &key, const T &obj) {
-        auto it = find(key);
-        if (it != this->end()) {
-            erase(it);
-            auto pr = insert(key, obj);
-            pr.second = false;
-            return pr;
+        auto result = tree_type::EmplaceUnique(key, key, obj);
+        if (!result.second) {
+            result.first->value_.second = obj;
         }
-        return insert(key, obj);
+        return std::pair<iterator, bool>(MakeIterator(result.first), result.second);
     }
 
-    template <typename Key, typename T>
+    template <typename Key, typename T, typename Compare>
     template <class... Args>
-    std::vector<std::pair<typename map<Key, T>::iterator, bool>>
-    map<Key, T>::insert_many(Args &&...args) {
-        std::vector<std::pair<typename map<Key, T>::iterator, bool>> vec;
-        for (const auto &arg : {args...}) {
-            vec.push_back(insert(arg));
-        }
+    std::vector<std::pair<typename map<Key, T, Compare>::iterator, bool>>
+    map<Key, T, Compare>::insert_many(Args &&...args) {
+        std::vector<std::pair<typename map<Key, T, Compare>::iterator, bool>> vec;
+        vec.reserve(sizeof...(args));
+        (vec.push_back(emplace(std::forward<Args>(args))), ...);
         return vec;
     }
 
-    template <typename Key, typename T>
-    T &map<Key, T>::at(const Key &key) {
+    template <typename Key, typename T, typename Compare>
+    T &map<Key, T, Compare>::at(const Key &key) {
         auto it = find(key);
         if (it == this->end()) {
             throw std::out_of_range("Container does not have an element with the specified key");
@@ -181,62 +296,97 @@ namespace s21 {
         return it.return_value();
     }
 
-    template <typename Key, typename T>
-    T &map<Key, T>::operator[](const Key &key) {
-        auto it = find(key);
-        if (it == this->end()) {
-            auto pr = insert(std::make_pair(key, T()));
-            it = pr.first;
+    template <typename Key, typename T, typename Compare>
+    template <typename K, typename C, typename>
+    T &map<Key, T, Compare>::at(const K &key) {
+        auto node = tree_type::FindNode(key);
+        if (node == nullptr) {
+            throw std::out_of_range("Container does not have an element with the specified key");
         }
-        return it.return_value();
+        return node->value_.second;
+    }
+
+    template <typename Key, typename T, typename Compare>
+    T &map<Key, T, Compare>::operator[](const Key &key) {
+        // значение по умолчанию создается только если ключа еще нет
+        return tree_type::EmplaceUnique(key, std::piecewise_construct, std::forward_as_tuple(key),
+                                        std::tuple<>()).first->value_.second;
     }
 
-    template <typename Key, typename T>
-    typename map<Key, T>::iterator map<Key, T>::begin() {
-        return map<Key, T>::MapIterator(
-                BinaryTree<Key, T>::GetMin(BinaryTree<Key, T>::root_));
+    template <typename Key, typename T, typename Compare>
+    typename map<Key, T, Compare>::iterator map<Key, T, Compare>::begin() {
+        return MapIterator(this->header_.leftmost_, &this->header_);
     }
 
-    template <typename Key, typename T>
-    typename map<Key, T>::iterator map<Key, T>::end() {
-        if (BinaryTree<Key, T>::root_ == nullptr) return begin();
+    template <typename Key, typename T, typename Compare>
+    typename map<Key, T, Compare>::iterator map<Key, T, Compare>::end() {
+        return MapIterator(nullptr, &this->header_);
+    }
 
-        typename BinaryTree<Key, T>::Node *last_node =
-                BinaryTree<Key, T>::GetMax(BinaryTree<Key, T>::root_);
-        MapIterator test(nullptr, last_node);
-        return test;
+    template <typename Key, typename T, typename Compare>
+    typename map<Key, T, Compare>::const_iterator map<Key, T, Compare>::cbegin() const {
+        return ConstMapIterator(this->header_.leftmost_, &this->header_);
     }
 
-    template <typename Key, typename T>
-    typename map<Key, T>::const_iterator map<Key, T>::cbegin() const {
-        return map<Key, T>::ConstMapIterator(
-                BinaryTree<Key, T>::GetMin(BinaryTree<Key, T>::root_));
+    template <typename Key, typename T, typename Compare>
+    typename map<Key, T, Compare>::const_iterator map<Key, T, Compare>::cend() const {
+        return ConstMapIterator(nullptr, &this->header_);
     }
 
-    template <typename Key, typename T>
-    typename map<Key, T>::const_iterator map<Key, T>::cend() const {
-        if (BinaryTree<Key, T>::root_ == nullptr) return cbegin();
+    template <typename Key, typename T, typename Compare>
+    void map<Key, T, Compare>::merge(map &other) {
+        tree_type::merge(other);
+    }
 
-        typename BinaryTree<Key, T>::Node *last_node =
-                BinaryTree<Key, T>::GetMax(BinaryTree<Key, T>::root_);
-        ConstMapIterator test(nullptr, last_node);
-        return test;
+    template <typename Key, typename T, typename Compare>
+    typename map<Key, T, Compare>::iterator map<Key, T, Compare>::find_by_order(size_type k) {
+        return MakeIterator(tree_type::GetByOrder(k));
     }
 
-    template <typename Key, typename T>
-    void map<Key, T>::merge(map &other) {
-        map const_tree(other);
-        iterator const_it = const_tree.begin();
-        for (; const_it != const_tree.end(); ++const_it) {
-            auto key = (*const_it).first;
-            auto obj = (*const_it).second;
-            std::pair<iterator, bool> pr = insert(key, obj);
-            if (pr.second) other.erase(pr.first);
-        }
+    template <typename Key, typename T, typename Compare>
+    typename map<Key, T, Compare>::iterator map<Key, T, Compare>::lower_bound(const Key &key) {
+        return MakeIterator(tree_type::LowerBoundNode(key));
+    }
+
+    template <typename Key, typename T, typename Compare>
+    template <typename K, typename C, typename>
+    typename map<Key, T, Compare>::iterator map<Key, T, Compare>::lower_bound(const K &key) {
+        return MakeIterator(tree_type::LowerBoundNode(key));
+    }
+
+    template <typename Key, typename T, typename Compare>
+    typename map<Key, T, Compare>::iterator map<Key, T, Compare>::upper_bound(const Key &key) {
+        return MakeIterator(tree_type::UpperBoundNode(key));
+    }
+
+    template <typename Key, typename T, typename Compare>
+    template <typename K, typename C, typename>
+    typename map<Key, T, Compare>::iterator map<Key, T, Compare>::upper_bound(const K &key) {
+        return MakeIterator(tree_type::UpperBoundNode(key));
     }
 
-    template <typename Key, typename T>
-    bool map<Key, T>::contains(const Key &key) {
+    template <typename Key, typename T, typename Compare>
+    std::pair<typename map<Key, T, Compare>::iterator, typename map<Key, T, Compare>::iterator>
+    map<Key, T, Compare>::equal_range(const Key &key) {
+        auto nodes = tree_type::EqualRangeNodes(key);
+        return std::make_pair(MakeIterator(nodes.first), MakeIterator(nodes.second));
+    }
+
+    template <typename Key, typename T, typename Compare>
+    template <typename K, typename C, typename>
+    std::pair<typename map<Key, T, Compare>::iterator, typename map<Key, T, Compare>::iterator>
+    map<Key, T, Compare>::equal_range(const K &key) {
+        auto nodes = tree_type::EqualRangeNodes(key);
+        return std::make_pair(MakeIterator(nodes.first), MakeIterator(nodes.second));
+    }
+
+    template <typename Key, typename T, typename Compare>
+    typename map<Key, T, Compare>::iterator map<Key, T, Compare>::MakeIterator(typename tree_type::Node *node) {
+        return iterator(node, &this->header_);
+    }
+
+    template <typename Key, typename T, typename Compare>
+    bool map<Key, T, Compare>::contains(const Key &key) {
         bool contains_res = false;
         auto it = find(key);
         if (it != this->end()) {
@@ -245,11 +395,50 @@ namespace s21 {
         return contains_res;
     }
 
-    template <typename Key, typename T>
-    void map<Key, T>::erase(map::iterator pos) {
-        if (BinaryTree<Key, T>::root_ == nullptr || pos.it_node_ == nullptr) return;
-        BinaryTree<Key, T>::root_ =
-                BinaryTree<Key, T>::RecursiveDelete(BinaryTree<Key, T>::root_, (*pos).first);
+    template <typename Key, typename T, typename Compare>
+    template <typename K, typename C, typename>
+    bool map<Key, T, Compare>::contains(const K &key) {
+        return tree_type::FindNode(key) != nullptr;
+    }
+
+    template <typename Key, typename T, typename Compare>
+    typename map<Key, T, Compare>::node_type map<Key, T, Compare>::extract(const Key &key) {
+        typename tree_type::Node *node = tree_type::FindNode(key);
+        if (node == nullptr) return node_type();
+        return tree_type::ExtractNode(node);
+    }
+
+    template <typename Key, typename T, typename Compare>
+    typename map<Key, T, Compare>::insert_return_type map<Key, T, Compare>::insert(node_type &&nh) {
+        if (nh.empty()) return insert_return_type{end(), false, node_type()};
+        auto result = tree_type::InsertHandle(nullptr, nh);
+        if (result.second) return insert_return_type{MakeIterator(result.first), true, node_type()};
+        return insert_return_type{MakeIterator(result.first), false, std::move(nh)};
+    }
+
+    template <typename Key, typename T, typename Compare>
+    typename map<Key, T, Compare>::iterator map<Key, T, Compare>::insert(iterator hint, node_type &&nh) {
+        if (nh.empty()) return end();
+        return MakeIterator(tree_type::InsertHandle(hint.it_node_, nh).first);
+    }
+
+    template <typename Key, typename T, typename Compare>
+    void map<Key, T, Compare>::erase(map::iterator pos) {
+        if (tree_type::root_ == nullptr || pos.it_node_ == nullptr) return;
+        tree_type::DeleteNode(pos.it_node_);
+    }
+
+    template <typename Key, typename T, typename Compare>
+    typename map<Key, T, Compare>::iterator map<Key, T, Compare>::erase(iterator first, iterator last) {
+        if (first.it_node_ != nullptr) {
+            tree_type::EraseRange(first.it_node_, last.it_node_);
+        }
+        return last;
+    }
+
+    template <typename Key, typename T, typename Compare, typename Pred>
+    typename map<Key, T, Compare>::size_type erase_if(map<Key, T, Compare> &container, Pred pred) {
+        return container.RemoveIf(pred);
     }
 
 } // namespace s21
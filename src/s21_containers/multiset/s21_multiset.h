@@ -1,7 +1,465 @@
 #ifndef SRC_S21_MULTISET_H
 #define SRC_S21_MULTISET_H
 
+#include <algorithm>
+#include <initializer_list>
+#include <iterator>
+#include <vector>
+
+#include "../AVLTree/BinaryTree.h"
 
 // Multiset похож на set
 // Исключение: в multiset-е могут храниться повторяющиеся значения
+
+// Равные значения лежат подряд в порядке вставки: новая копия встает после уже имеющихся.
+// count и equal_range работают за O(log n) при любом числе копий - размеры поддеревьев дают ранги границ.
+
+// Compact = true - компактный режим для сильно повторяющихся данных: на каждый различный ключ один узел
+// со счетчиком копий, память O(различных ключей). Итератор при этом проходит каждую копию, как и обычный.
+// Копии в этом режиме неразличимы, поэтому хранится только первая вставленная.
+
+namespace s21 {
+    template <typename Key, typename Compare = std::less<Key>, bool Compact = false>
+    class multiset : public BinaryTree<Key, Key, IdentityKey<Key>, Compare> {
+        // в узле multiset-а хранится сам ключ, на каждую копию свой узел
+        using tree_type = BinaryTree<Key, Key, IdentityKey<Key>, Compare>;
+
+    public:
+        using key_type = Key;
+        using value_type = Key;
+        using reference = value_type &;
+        using const_reference = const value_type &;
+        using iterator = typename tree_type::Iterator;
+        using const_iterator = typename tree_type::ConstIterator;
+        using size_type = size_t;
+
+        multiset() : tree_type(){};
+        multiset(std::initializer_list<value_type> const &items);
+        // builds the multiset in O(n) if [first, last) is sorted, otherwise sorts it first
+        template <typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category>
+        multiset(InputIt first, InputIt last);
+        multiset(const multiset &other) : tree_type(other){};
+        multiset(multiset &&other) noexcept : tree_type(std::move(other)){};
+        multiset &operator=(multiset &&other) noexcept;
+        multiset &operator=(const multiset &other);
+        ~multiset() = default;
+
+        using tree_type::erase;
+        iterator find(const key_type &key) { return Find(key); }; // returns the first element with key or end()
+        template <typename K, typename C = Compare, typename = typename C::is_transparent>
+        iterator find(const K &key) { return Find(key); };
+        iterator insert(const value_type &value); // inserts value after the elements equal to it
+        iterator insert(value_type &&value);
+        // inserts an element built in place from args
+        template <class... Args>
+        iterator emplace(Args &&...args);
+        template <class... Args>
+        std::vector<iterator> insert_many(Args &&...args);
+        size_type erase(const key_type &key); // erases every element with key and returns how many were erased
+        size_type count(const key_type &key) { return Count(key); }; // returns the number of elements with key
+        template <typename K, typename C = Compare, typename = typename C::is_transparent>
+        size_type count(const K &key) { return Count(key); };
+        std::pair<iterator, iterator> equal_range(const key_type &key) { return EqualRange(key); };
+        template <typename K, typename C = Compare, typename = typename C::is_transparent>
+        std::pair<iterator, iterator> equal_range(const K &key) { return EqualRange(key); };
+
+        // erases every element the predicate holds for and returns how many were erased
+        template <typename K, typename C, typename Pred>
+        friend typename multiset<K, C, false>::size_type erase_if(multiset<K, C, false> &container, Pred pred);
+
+    private:
+        // у set-а эти операции выбрасывают повторы или рассчитаны на один узел с ключом
+        using tree_type::assign_sorted;
+        using tree_type::merge;
+        using tree_type::split;
+        using tree_type::join;
+        using tree_type::extract;
+
+        template <typename K>
+        iterator Find(const K &key);
+        template <typename K>
+        size_type Count(const K &key);
+        template <typename K>
+        std::pair<iterator, iterator> EqualRange(const K &key);
+    };
+
+    template <typename Key, typename Compare, bool Compact>
+    multiset<Key, Compare, Compact>::multiset(const std::initializer_list<value_type> &items) {
+        tree_type::AssignSorted(items.begin(), items.end(), false);
+    }
+
+    template <typename Key, typename Compare, bool Compact>
+    template <typename InputIt, typename>
+    multiset<Key, Compare, Compact>::multiset(InputIt first, InputIt last) {
+        tree_type::AssignSorted(first, last, false);
+    }
+
+    template <typename Key, typename Compare, bool Compact>
+    multiset<Key, Compare, Compact> &multiset<Key, Compare, Compact>::operator=(multiset &&other) noexcept {
+        if (this != &other) {
+            tree_type::operator=(std::move(other));
+        }
+        return *this;
+    }
+
+    template <typename Key, typename Compare, bool Compact>
+    multiset<Key, Compare, Compact> &multiset<Key, Compare, Compact>::operator=(const multiset &other) {
+        if (this != &other) {
+            tree_type::operator=(other);
+        }
+        return *this;
+    }
+
+    template <typename Key, typename Compare, bool Compact>
+    typename multiset<Key, Compare, Compact>::iterator multiset<Key, Compare, Compact>::insert(const value_type &value) {
+        return tree_type::MakeIterator(tree_type::EmplaceMulti(value, value));
+    }
+
+    template <typename Key, typename Compare, bool Compact>
+    typename multiset<Key, Compare, Compact>::iterator multiset<Key, Compare, Compact>::insert(value_type &&value) {
+        return tree_type::MakeIterator(tree_type::EmplaceMulti(value, std::move(value)));
+    }
+
+    template <typename Key, typename Compare, bool Compact>
+    template <class... Args>
+    typename multiset<Key, Compare, Compact>::iterator multiset<Key, Compare, Compact>::emplace(Args &&...args) {
+        value_type key(std::forward<Args>(args)...);
+        return insert(std::move(key));
+    }
+
+    template <typename Key, typename Compare, bool Compact>
+    template <class... Args>
+    std::vector<typename multiset<Key, Compare, Compact>::iterator> multiset<Key, Compare, Compact>::insert_many(
+            Args &&...args) {
+        std::vector<iterator> vec;
+        vec.reserve(sizeof...(args));
+        (vec.push_back(emplace(std::forward<Args>(args))), ...);
+        return vec;
+    }
+
+    template <typename Key, typename Compare, bool Compact>
+    typename multiset<Key, Compare, Compact>::size_type multiset<Key, Compare, Compact>::erase(const key_type &key) {
+        auto *first = tree_type::LowerBoundNode(key);
+        auto *last = tree_type::UpperBoundNode(key);
+        size_type count = tree_type::RankOf(last) - tree_type::RankOf(first);
+        if (count != 0) {
+            tree_type::EraseRange(first, last);
+        }
+        return count;
+    }
+
+    template <typename Key, typename Compare, bool Compact>
+    template <typename K>
+    typename multiset<Key, Compare, Compact>::iterator multiset<Key, Compare, Compact>::Find(const K &key) {
+        // FindNode вернул бы любую из копий, а нужна первая
+        auto *node = tree_type::LowerBoundNode(key);
+        if (node == nullptr || this->comp_(key, tree_type::KeyOf(node))) {
+            return this->end();
+        }
+        return tree_type::MakeIterator(node);
+    }
+
+    template <typename Key, typename Compare, bool Compact>
+    template <typename K>
+    typename multiset<Key, Compare, Compact>::size_type multiset<Key, Compare, Compact>::Count(const K &key) {
+        return tree_type::RankOf(tree_type::UpperBoundNode(key)) - tree_type::RankOf(tree_type::LowerBoundNode(key));
+    }
+
+    template <typename Key, typename Compare, bool Compact>
+    template <typename K>
+    std::pair<typename multiset<Key, Compare, Compact>::iterator, typename multiset<Key, Compare, Compact>::iterator>
+    multiset<Key, Compare, Compact>::EqualRange(const K &key) {
+        return std::make_pair(tree_type::MakeIterator(tree_type::LowerBoundNode(key)),
+                              tree_type::MakeIterator(tree_type::UpperBoundNode(key)));
+    }
+
+    template <typename Key, typename Compare, typename Pred>
+    typename multiset<Key, Compare, false>::size_type erase_if(multiset<Key, Compare, false> &container, Pred pred) {
+        return container.RemoveIf(pred);
+    }
+
+    // компактный режим: узел хранит ключ и число его копий
+    template <typename Key, typename Compare>
+    class multiset<Key, Compare, true>
+            : private BinaryTree<Key, std::pair<const Key, size_t>, PairFirstKey<std::pair<const Key, size_t>>, Compare> {
+        using tree_type = BinaryTree<Key, std::pair<const Key, size_t>, PairFirstKey<std::pair<const Key, size_t>>, Compare>;
+        using node_iterator = typename tree_type::Iterator;
+
+    public:
+        class CompactIterator;
+
+        using key_type = Key;
+        using value_type = Key;
+        using reference = const value_type &; // копии делят один узел, менять их нельзя
+        using const_reference = const value_type &;
+        using iterator = CompactIterator;
+        using const_iterator = CompactIterator;
+        using size_type = size_t;
+        using key_compare = Compare;
+
+        multiset() : tree_type(), copies_(0){};
+        multiset(std::initializer_list<value_type> const &items);
+        template <typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category>
+        multiset(InputIt first, InputIt last);
+        multiset(const multiset &other) : tree_type(other), copies_(other.copies_){};
+        multiset(multiset &&other) noexcept;
+        multiset &operator=(multiset &&other) noexcept;
+        multiset &operator=(const multiset &other);
+        ~multiset() = default;
+
+        iterator begin() { return iterator(tree_type::begin(), 0); };
+        iterator end() { return iterator(tree_type::end(), 0); };
+
+        bool empty() const { return copies_ == 0; };
+        size_type size() const { return copies_; }; // returns the number of elements counting every copy
+        size_type max_size() { return tree_type::max_size(); };
+        size_type distinct_size() const { return tree_type::size(); }; // returns the number of different keys (and nodes)
+        void clear();
+        void swap(multiset &other);
+        key_compare key_comp() const { return tree_type::key_comp(); };
+
+        iterator insert(const value_type &value); // adds a copy of value and returns iterator to it
+        iterator insert(value_type &&value);
+        template <class... Args>
+        iterator emplace(Args &&...args);
+        template <class... Args>
+        std::vector<iterator> insert_many(Args &&...args);
+        // erases one copy and returns the iterator to the element after it. Copies of a key share one counter,
+        // so the other iterators to this key become invalid (the node itself is freed with its last copy)
+        iterator erase(iterator pos);
+        size_type erase(const key_type &key); // erases every copy of key and returns how many were erased
+
+        bool contains(const key_type &key) const { return tree_type::FindNode(key) != nullptr; };
+        template <typename K, typename C = Compare, typename = typename C::is_transparent>
+        bool contains(const K &key) const { return tree_type::FindNode(key) != nullptr; };
+        size_type count(const key_type &key) const { return Count(key); }; // the number of copies of key in O(log n)
+        template <typename K, typename C = Compare, typename = typename C::is_transparent>
+        size_type count(const K &key) const { return Count(key); };
+        iterator find(const key_type &key) { return Find(key); }; // returns the first copy of key or end()
+        template <typename K, typename C = Compare, typename = typename C::is_transparent>
+        iterator find(const K &key) { return Find(key); };
+        iterator lower_bound(const key_type &key) { return MakeIterator(tree_type::LowerBoundNode(key)); };
+        template <typename K, typename C = Compare, typename = typename C::is_transparent>
+        iterator lower_bound(const K &key) { return MakeIterator(tree_type::LowerBoundNode(key)); };
+        iterator upper_bound(const key_type &key) { return MakeIterator(tree_type::UpperBoundNode(key)); };
+        template <typename K, typename C = Compare, typename = typename C::is_transparent>
+        iterator upper_bound(const K &key) { return MakeIterator(tree_type::UpperBoundNode(key)); };
+        std::pair<iterator, iterator> equal_range(const key_type &key) { return EqualRange(key); };
+        template <typename K, typename C = Compare, typename = typename C::is_transparent>
+        std::pair<iterator, iterator> equal_range(const K &key) { return EqualRange(key); };
+
+        // visits every copy of every key in order; a position is the node and the number of the copy in it
+        class CompactIterator {
+        public:
+            friend class multiset;
+            using iterator_category = std::bidirectional_iterator_tag;
+            using difference_type = std::ptrdiff_t;
+            using value_type = Key;
+            using pointer = const Key *;
+            using reference = const Key &;
+
+            CompactIterator() : node_it_(), copy_(0){};
+
+            reference operator*() const { return node_it_->first; };
+            pointer operator->() const { return &node_it_->first; };
+            CompactIterator &operator++();
+            CompactIterator operator++(int);
+            CompactIterator &operator--();
+            CompactIterator operator--(int);
+            bool operator==(const CompactIterator &other) const;
+            bool operator!=(const CompactIterator &other) const { return !(*this == other); };
+
+        private:
+            CompactIterator(node_iterator node_it, size_type copy) : node_it_(node_it), copy_(copy){};
+
+            node_iterator node_it_;
+            size_type copy_; // number of the copy of the node's key, from 0
+        };
+
+    private:
+        size_type copies_; // number of elements with every copy; the tree's size_ counts nodes
+
+        template <typename V>
+        iterator Emplace(V &&value);
+        // the first copy of the key of node, end() for nullptr
+        iterator MakeIterator(typename tree_type::Node *node) { return iterator(tree_type::MakeIterator(node), 0); };
+        template <typename K>
+        iterator Find(const K &key) { return MakeIterator(tree_type::FindNode(key)); };
+        template <typename K>
+        size_type Count(const K &key) const;
+        template <typename K>
+        std::pair<iterator, iterator> EqualRange(const K &key);
+    };
+
+    template <typename Key, typename Compare>
+    multiset<Key, Compare, true>::multiset(const std::initializer_list<value_type> &items)
+            : multiset(items.begin(), items.end()) {}
+
+    template <typename Key, typename Compare>
+    template <typename InputIt, typename>
+    multiset<Key, Compare, true>::multiset(InputIt first, InputIt last) : multiset() {
+        for (; first != last; ++first) {
+            insert(*first);
+        }
+    }
+
+    template <typename Key, typename Compare>
+    multiset<Key, Compare, true>::multiset(multiset &&other) noexcept
+            : tree_type(std::move(other)), copies_(other.copies_) {
+        other.copies_ = 0;
+    }
+
+    template <typename Key, typename Compare>
+    multiset<Key, Compare, true> &multiset<Key, Compare, true>::operator=(multiset &&other) noexcept {
+        if (this != &other) {
+            tree_type::operator=(std::move(other));
+            copies_ = other.copies_;
+            other.copies_ = 0;
+        }
+        return *this;
+    }
+
+    template <typename Key, typename Compare>
+    multiset<Key, Compare, true> &multiset<Key, Compare, true>::operator=(const multiset &other) {
+        if (this != &other) {
+            tree_type::operator=(other);
+            copies_ = other.copies_;
+        }
+        return *this;
+    }
+
+    template <typename Key, typename Compare>
+    void multiset<Key, Compare, true>::clear() {
+        tree_type::clear();
+        copies_ = 0;
+    }
+
+    template <typename Key, typename Compare>
+    void multiset<Key, Compare, true>::swap(multiset &other) {
+        tree_type::swap(other);
+        std::swap(copies_, other.copies_);
+    }
+
+    template <typename Key, typename Compare>
+    typename multiset<Key, Compare, true>::iterator multiset<Key, Compare, true>::insert(const value_type &value) {
+        return Emplace(value);
+    }
+
+    template <typename Key, typename Compare>
+    typename multiset<Key, Compare, true>::iterator multiset<Key, Compare, true>::insert(value_type &&value) {
+        return Emplace(std::move(value));
+    }
+
+    template <typename Key, typename Compare>
+    template <class... Args>
+    typename multiset<Key, Compare, true>::iterator multiset<Key, Compare, true>::emplace(Args &&...args) {
+        value_type key(std::forward<Args>(args)...);
+        return Emplace(std::move(key));
+    }
+
+    template <typename Key, typename Compare>
+    template <class... Args>
+    std::vector<typename multiset<Key, Compare, true>::iterator> multiset<Key, Compare, true>::insert_many(
+            Args &&...args) {
+        std::vector<iterator> vec;
+        vec.reserve(sizeof...(args));
+        (vec.push_back(emplace(std::forward<Args>(args))), ...);
+        return vec;
+    }
+
+    template <typename Key, typename Compare>
+    typename multiset<Key, Compare, true>::iterator multiset<Key, Compare, true>::erase(iterator pos) {
+        // следующий элемент находится до уменьшения счетчика: копии после pos сдвигаются на его место,
+        // а если копия была последней, узел освобождается и следующим становится первая копия соседнего узла
+        size_type &copies = pos.node_it_->second;
+        size_type copy = std::min(pos.copy_, copies - 1);
+        node_iterator next_node = pos.node_it_;
+        ++next_node;
+        iterator next = copy + 1 < copies ? iterator(pos.node_it_, copy) : iterator(next_node, 0);
+        if (--copies == 0) {
+            tree_type::erase(pos.node_it_);
+        }
+        --copies_;
+        return next;
+    }
+
+    template <typename Key, typename Compare>
+    typename multiset<Key, Compare, true>::size_type multiset<Key, Compare, true>::erase(const key_type &key) {
+        node_iterator it = tree_type::Find(key);
+        if (it == tree_type::end()) {
+            return 0;
+        }
+        size_type count = it->second;
+        tree_type::erase(it);
+        copies_ -= count;
+        return count;
+    }
+
+    template <typename Key, typename Compare>
+    template <typename K>
+    typename multiset<Key, Compare, true>::size_type multiset<Key, Compare, true>::Count(const K &key) const {
+        typename tree_type::Node *node = tree_type::FindNode(key);
+        return node == nullptr ? 0 : node->value_.second;
+    }
+
+    template <typename Key, typename Compare>
+    template <typename K>
+    std::pair<typename multiset<Key, Compare, true>::iterator, typename multiset<Key, Compare, true>::iterator>
+    multiset<Key, Compare, true>::EqualRange(const K &key) {
+        auto nodes = tree_type::EqualRangeNodes(key);
+        return std::make_pair(MakeIterator(nodes.first), MakeIterator(nodes.second));
+    }
+
+    template <typename Key, typename Compare>
+    template <typename V>
+    typename multiset<Key, Compare, true>::iterator multiset<Key, Compare, true>::Emplace(V &&value) {
+        // узел со счетчиком 0 создается только для нового ключа, затем счетчик растет в любом случае
+        auto *node = tree_type::EmplaceUnique(value, std::forward<V>(value), size_type(0)).first;
+        ++copies_;
+        return iterator(tree_type::MakeIterator(node), node->value_.second++);
+    }
+
+    template <typename Key, typename Compare>
+    typename multiset<Key, Compare, true>::CompactIterator &multiset<Key, Compare, true>::CompactIterator::operator++() {
+        // >=, а не ==: erase другой копии мог уменьшить счетчик ниже copy_
+        if (++copy_ >= node_it_->second) {
+            ++node_it_;
+            copy_ = 0;
+        }
+        return *this;
+    }
+
+    template <typename Key, typename Compare>
+    typename multiset<Key, Compare, true>::CompactIterator multiset<Key, Compare, true>::CompactIterator::operator++(int) {
+        CompactIterator tmp = *this;
+        ++*this;
+        return tmp;
+    }
+
+    template <typename Key, typename Compare>
+    typename multiset<Key, Compare, true>::CompactIterator &multiset<Key, Compare, true>::CompactIterator::operator--() {
+        if (copy_ > 0) {
+            --copy_;
+        } else {
+            --node_it_;
+            copy_ = node_it_->second - 1;
+        }
+        return *this;
+    }
+
+    template <typename Key, typename Compare>
+    typename multiset<Key, Compare, true>::CompactIterator multiset<Key, Compare, true>::CompactIterator::operator--(int) {
+        CompactIterator tmp = *this;
+        --*this;
+        return tmp;
+    }
+
+    template <typename Key, typename Compare>
+    bool multiset<Key, Compare, true>::CompactIterator::operator==(const CompactIterator &other) const {
+        node_iterator node_it = node_it_; // сравнение у итератора дерева не const
+        return node_it == other.node_it_ && copy_ == other.copy_;
+    }
+
+} // namespace s21
+
 #endif //SRC_S21_MULTISET_H
@@ -15,64 +15,145 @@
 // Альтернативное решение: удалить элемент и добавить новый
 
 namespace s21 {
-    template <typename Key>
-    class set : public BinaryTree<Key, Key> {
+    // снимок для freeze() (s21_containersplus): нужен целиком только там, где freeze() вызывают
+    template <typename Key, typename Compare>
+    class frozen_set;
+
+    template <typename Key, typename Compare = std::less<Key>>
+    class set : public BinaryTree<Key, Key, IdentityKey<Key>, Compare> {
+        // в узле set-а хранится только сам ключ
+        using tree_type = BinaryTree<Key, Key, IdentityKey<Key>, Compare>;
+
     public:
         using key_type = Key;
         using value_type = Key;
         using reference = value_type &;
         using const_reference = const value_type &;
-        using iterator = typename BinaryTree<Key, Key>::Iterator;
-        using const_iterator = typename BinaryTree<Key, Key>::ConstIterator;
+        using iterator = typename tree_type::Iterator;
+        using const_iterator = typename tree_type::ConstIterator;
         using size_type = size_t;
 
-        set() : BinaryTree<Key, Key>(){};
+        set() : tree_type(){};
         set(std::initializer_list<value_type> const &items);
-        set(const set &other) : BinaryTree<Key, Key>(other) {};
-        set(set &&other) noexcept : BinaryTree<Key, Key>(std::move(other)){};
+        // builds the set in O(n) if [first, last) is sorted, otherwise sorts it first
+        template <typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category>
+        set(InputIt first, InputIt last);
+        set(const set &other) : tree_type(other) {};
+        set(set &&other) noexcept : tree_type(std::move(other)){};
         set &operator=(set &&other) noexcept;
         set &operator=(const set &other);
         ~set() = default;
 
-        iterator find(const key_type &key) { return BinaryTree<Key, Key>::Find(key); };
+        iterator find(const key_type &key) { return tree_type::Find(key); };
+        template <typename K, typename C = Compare, typename = typename C::is_transparent>
+        iterator find(const K &key) { return tree_type::Find(key); };
+        // inserts an element built in place from args
+        template <class... Args>
+        std::pair<iterator, bool> emplace(Args &&...args);
+        // emplace with a hint, see BinaryTree::insert(hint, key)
+        template <class... Args>
+        iterator emplace_hint(iterator hint, Args &&...args);
+        // immutable copy with a faster search; needs s21_containersplus/frozen_set/s21_frozen_set.h where it is called
+        frozen_set<Key, Compare> freeze() const {
+            return frozen_set<Key, Compare>(this->cbegin(), this->cend(), this->comp_);
+        };
         template <class... Args>
         std::vector<std::pair<iterator, bool>> insert_many(Args &&...args);
+
+        // erases every element the predicate holds for and returns how many were erased
+        template <typename K, typename C, typename Pred>
+        friend typename set<K, C>::size_type erase_if(set<K, C> &container, Pred pred);
+
+        // set algebra in O(m log(n/m + 1)) for sizes m <= n. Union and difference are sinks: they take the sets
+        // by rvalue reference, reuse their nodes and leave them empty. To keep a set, pass a copy explicitly
+        // (set_union(set(a), std::move(b))) - it costs O(n). Of equal elements the lhs one is kept
+        template <typename K, typename C>
+        friend set<K, C> set_union(set<K, C> &&lhs, set<K, C> &&rhs);
+        // only the common elements are copied, both sets stay as they are
+        template <typename K, typename C>
+        friend set<K, C> set_intersection(const set<K, C> &lhs, const set<K, C> &rhs);
+        // lhs is a sink as in set_union, rhs stays as it is
+        template <typename K, typename C>
+        friend set<K, C> set_difference(set<K, C> &&lhs, const set<K, C> &rhs);
     };
 
-    template <typename Key>
-    set<Key>::set(const std::initializer_list<value_type> &items) {
-        for (auto i = items.begin(); i != items.end(); ++i) {
-            BinaryTree<Key, Key>::insert(*i);
-        }
+    template <typename Key, typename Compare>
+    set<Key, Compare>::set(const std::initializer_list<value_type> &items) {
+        tree_type::assign_sorted(items.begin(), items.end());
+    }
+
+    template <typename Key, typename Compare>
+    template <typename InputIt, typename>
+    set<Key, Compare>::set(InputIt first, InputIt last) {
+        tree_type::assign_sorted(first, last);
     }
 
-    template <typename Key>
-    set<Key> &set<Key>::operator=(set &&other) noexcept {
+    template <typename Key, typename Compare>
+    set<Key, Compare> &set<Key, Compare>::operator=(set &&other) noexcept {
         if (this != &other) {
-            BinaryTree<Key, Key>::operator=(std::move(other));
+            tree_type::operator=(std::move(other));
         }
         return *this;
     }
 
-    template <typename Key>
-    set<Key> &set<Key>::operator=(const set &other) {
+    template <typename Key, typename Compare>
+    set<Key, Compare> &set<Key, Compare>::operator=(const set &other) {
         if (this != &other) {
-            BinaryTree<Key, Key>::operator=(other);
+            tree_type::operator=(other);
         }
         return *this;
     }
 
-    template <typename Key>
+    template <typename Key, typename Compare>
     template <class... Args>
-    std::vector<std::pair<typename set<Key>::iterator, bool>> set<Key>::insert_many(
+    std::vector<std::pair<typename set<Key, Compare>::iterator, bool>> set<Key, Compare>::insert_many(
             Args &&...args) {
-        std::vector<std::pair<typename set<Key>::iterator, bool>> vec;
-        for (const auto &arg : {args...}) {
-            vec.push_back(BinaryTree<Key, Key>::insert(arg));
-        }
+        std::vector<std::pair<typename set<Key, Compare>::iterator, bool>> vec;
+        vec.reserve(sizeof...(args));
+        (vec.push_back(emplace(std::forward<Args>(args))), ...);
         return vec;
     }
 
+    template <typename Key, typename Compare>
+    template <class... Args>
+    std::pair<typename set<Key, Compare>::iterator, bool> set<Key, Compare>::emplace(Args &&...args) {
+        value_type key(std::forward<Args>(args)...);
+        return tree_type::insert(std::move(key));
+    }
+
+    template <typename Key, typename Compare>
+    template <class... Args>
+    typename set<Key, Compare>::iterator set<Key, Compare>::emplace_hint(iterator hint, Args &&...args) {
+        value_type key(std::forward<Args>(args)...);
+        return tree_type::insert(hint, std::move(key));
+    }
+
+    template <typename Key, typename Compare, typename Pred>
+    typename set<Key, Compare>::size_type erase_if(set<Key, Compare> &container, Pred pred) {
+        return container.RemoveIf(pred);
+    }
+
+    template <typename Key, typename Compare>
+    set<Key, Compare> set_union(set<Key, Compare> &&lhs, set<Key, Compare> &&rhs) {
+        set<Key, Compare> result(std::move(lhs));
+        result.UnionWith(rhs);
+        return result;
+    }
+
+    template <typename Key, typename Compare>
+    set<Key, Compare> set_intersection(const set<Key, Compare> &lhs, const set<Key, Compare> &rhs) {
+        set<Key, Compare> result;
+        result.AssignIntersection(lhs, rhs);
+        return result;
+    }
+
+    template <typename Key, typename Compare>
+    set<Key, Compare> set_difference(set<Key, Compare> &&lhs, const set<Key, Compare> &rhs) {
+        set<Key, Compare> result(std::move(lhs));
+        result.Subtract(rhs);
+        return result;
+    }
+
 } // namespace s21
 
 #endif //SRC_S21_SET_H
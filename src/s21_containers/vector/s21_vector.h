@@ -5,6 +5,7 @@
 #include <limits>
 //#include "s21_vector_iterators.h"
 #include <initializer_list>
+#include <utility>
 //using namespace std;
 
 // Конструктор по умолчанию - позволяет создать объект класса с параметрами, которые нужны
@@ -52,6 +53,7 @@ namespace s21 {
         const_reference front() const; // access the first element
         const_reference back() const; // access the last element
         iterator_pointer data() noexcept; // direct access to the underlying array
+        const_iterator_pointer data() const noexcept;
 
         iterator begin(); // returns an iterator to the beginning
         iterator end(); // returns an iterator to the end
@@ -69,6 +71,7 @@ namespace s21 {
         iterator insert(iterator pos, const_reference value); // inserts elements into concrete pos and returns the iterator that points to the new element
         void erase(iterator pos); // erases element at pos
         void push_back(const_reference value); // adds an element to the end
+        void push_back(value_type &&value); // adds an element to the end moving it in
         void pop_back(); // removes the last element
         void swap(vector &other); // swaps the contents
 
@@ -98,6 +98,11 @@ namespace s21 {
         return data_;
     }
 
+    template<typename T>
+    typename vector<T>::const_iterator_pointer vector<T>::data() const noexcept {
+        return data_;
+    }
+
     template<typename T>
     typename vector<T>::iterator vector<T>::begin() {
         return iterator(data_);
@@ -218,6 +223,14 @@ namespace s21 {
         data_[size_++] = value;
     }
 
+    template<typename T>
+    void vector<T>::push_back(value_type &&value) {
+        if (size_ == capacity_) {
+            reserve(capacity_ ? capacity_ * 2 : 1);
+        }
+        data_[size_++] = std::move(value);
+    }
+
     template<typename T>
     void vector<T>::pop_back() {
         if (size_ > 0) {
@@ -2,5 +2,16 @@
 #define SRC_S21_CONTAINERSPLUS_H
 
 #include "s21_containersplus/array/s21_array.h"
+#include "s21_containersplus/btree_map/s21_btree_map.h"
+#include "s21_containersplus/btree_set/s21_btree_set.h"
+#include "s21_containersplus/flat_map/s21_flat_map.h"
+#include "s21_containersplus/flat_set/s21_flat_set.h"
+#include "s21_containersplus/frozen_map/s21_frozen_map.h"
+#include "s21_containersplus/frozen_set/s21_frozen_set.h"
+#include "s21_containersplus/mapped_map/s21_mapped_map.h"
+#include "s21_containersplus/mapped_set/s21_mapped_set.h"
+#include "s21_containersplus/persistent_map/s21_persistent_map.h"
+#include "s21_containersplus/unordered_map/s21_unordered_map.h"
+#include "s21_containersplus/unordered_set/s21_unordered_set.h"
 
 #endif //SRC_S21_CONTAINERSPLUS_H
@@ -0,0 +1,903 @@
+#ifndef SRC_BTREE_H
+#define SRC_BTREE_H
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "../../s21_containers/AVLTree/KeyOfValue.h"
+
+// BTree - B-дерево для btree_map и btree_set. В узле подряд лежат десятки значений (узел занимает
+// несколько кэш-линий), поэтому поиск делает по одному промаху кэша на уровень, а уровней в разы
+// меньше, чем у BinaryTree. Значения хранятся во всех узлах, у внутренних узлов есть еще массив детей.
+// При вставке и удалении значения переезжают внутри узлов (move-конструктор + деструктор), поэтому,
+// в отличие от BinaryTree, любое изменение дерева делает итераторы и ссылки на элементы недействительными.
+
+namespace s21 {
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare = std::less<Key>>
+    class BTree {
+    protected:
+        struct Node;
+    public:
+        class Iterator;
+        class ConstIterator;
+
+        using key_type = Key;
+        using value_type = Value;
+        using reference = value_type &;
+        using const_reference = const value_type &;
+        using iterator = Iterator;
+        using const_iterator = ConstIterator;
+        using size_type = size_t;
+        using key_compare = Compare;
+
+        class Iterator {
+        public:
+            friend class BTree<Key, Value, KeyOfValue, Compare>;
+            using iterator_category = std::bidirectional_iterator_tag;
+            using difference_type = std::ptrdiff_t;
+            using value_type = Value;
+            using pointer = Value *;
+            using reference = Value &;
+
+            Iterator() = default;
+            Iterator(Node *node, int position) : node_(node), position_(position) {};
+
+            reference operator*() const; // returns the stored value (the key for set, the key-value pair for map)
+            pointer operator->() const;
+            Iterator &operator++();
+            Iterator operator++(int);
+            Iterator &operator--();
+            Iterator operator--(int);
+            bool operator==(const Iterator &other) const;
+            bool operator!=(const Iterator &other) const;
+
+        protected:
+            Node *node_ = nullptr;
+            int position_ = 0; // index of the value in node_ (node_->count_ for end())
+        };
+
+        class ConstIterator : public Iterator {
+        public:
+            ConstIterator() : Iterator() {};
+            ConstIterator(const Iterator &other) : Iterator(other) {};
+            const_reference operator*() const { return Iterator::operator*(); };
+            const value_type *operator->() const { return Iterator::operator->(); };
+        };
+
+        BTree() = default; // default constructor
+        BTree(const BTree &other); // copy constructor
+        BTree(BTree &&other) noexcept; // move constructor
+        ~BTree(); // destructor
+        BTree &operator=(const BTree &other);
+        BTree &operator=(BTree &&other) noexcept;
+
+        iterator begin();
+        iterator end();
+        const_iterator cbegin() const;
+        const_iterator cend() const;
+
+        void clear(); // clears the tree contents
+        bool empty(); // checks whether the container is empty
+        size_type size(); // returns the number of elements
+        size_type max_size(); // returns the maximum possible number of elements
+        void erase(iterator pos); // erases element at pos
+        // erases [first, last) and returns the iterator to the element that followed them; a short run is erased
+        // value by value, a long one - in one pass that moves the remaining values into new nodes
+        iterator erase(iterator first, iterator last);
+        void swap(BTree &other); // swaps the contents
+        void merge(BTree &other); // moves the elements of other whose keys are not here yet
+        bool contains(const Key &key);
+        template<typename K, typename C = Compare, typename = typename C::is_transparent>
+        bool contains(const K &key);
+        size_type count(const Key &key); // returns the number of elements with key (0 or 1)
+        template<typename K, typename C = Compare, typename = typename C::is_transparent>
+        size_type count(const K &key);
+        key_compare key_comp() const; // returns the function that compares keys
+        iterator lower_bound(const Key &key); // returns iterator to the first element not less than key or end()
+        template<typename K, typename C = Compare, typename = typename C::is_transparent>
+        iterator lower_bound(const K &key);
+        iterator upper_bound(const Key &key); // returns iterator to the first element greater than key or end()
+        template<typename K, typename C = Compare, typename = typename C::is_transparent>
+        iterator upper_bound(const K &key);
+        std::pair<iterator, iterator> equal_range(const Key &key); // returns the range of elements with key
+        template<typename K, typename C = Compare, typename = typename C::is_transparent>
+        std::pair<iterator, iterator> equal_range(const K &key);
+
+    protected:
+        static constexpr size_type kCacheLine = 64;
+        // значения листа вместе с заголовком занимают около четырех кэш-линий
+        static constexpr size_type kValuesSize = 4 * kCacheLine - 16;
+        static constexpr int kMaxValues =
+                static_cast<int>(std::max<size_type>(3, std::min<size_type>(255, kValuesSize / sizeof(Value))));
+        static constexpr int kMinValues = (kMaxValues - 1) / 2; // every node but the root holds at least this many values - a split leaves that many on the right
+
+        struct Node {
+            Node *parent_ = nullptr;
+            unsigned short position_ = 0; // index of this node among the children of parent_
+            unsigned short count_ = 0; // number of values
+            bool leaf_ = true;
+            alignas(Value) unsigned char slots_[kMaxValues * sizeof(Value)];
+
+            Value *Slot(int i) { return reinterpret_cast<Value *>(slots_) + i; }
+            Value &value(int i) { return *std::launder(Slot(i)); }
+        };
+
+        struct InternalNode : Node {
+            Node *children_[kMaxValues + 1] = {};
+        };
+
+        Compare comp_;
+        Node *root_ = nullptr;
+        size_type size_ = 0; // number of elements, kept by every modifying operation
+
+        static Node *NewNode(bool leaf);
+        static void FreeNode(Node *node);
+        static Node *&Child(Node *node, int i) { return static_cast<InternalNode *>(node)->children_[i]; }
+        static const Key &KeyOf(Node *node, int i) { return KeyOfValue()(node->value(i)); }
+        static Node *Leftmost(Node *node);
+        static Node *Rightmost(Node *node);
+        // moves the value from one slot to an empty one and destroys the source
+        static void Relocate(Node *from, int from_pos, Node *to, int to_pos);
+        static void SetChild(Node *parent, int i, Node *child);
+
+        // copy and delete subtrees (the recursion depth is the tree height - a few levels)
+        Node *CopySubtree(Node *node, Node *parent);
+        void FreeSubtree(Node *node);
+
+        template<typename K>
+        int LowerBoundIn(Node *node, const K &key) const; // first position in node not less than key
+        template<typename K>
+        int UpperBoundIn(Node *node, const K &key) const; // first position in node greater than key
+        template<typename K>
+        iterator Find(const K &key); // iterator to the element with key or end()
+        template<typename K>
+        iterator LowerBound(const K &key);
+        template<typename K>
+        iterator UpperBound(const K &key);
+        template<typename K>
+        std::pair<iterator, iterator> EqualRange(const K &key);
+
+        // returns the element with key and whether the insertion took place;
+        // the value is built from args (its key must be key) only if the key is not in the tree yet
+        template<typename... Args>
+        std::pair<iterator, bool> EmplaceUnique(const Key &key, Args &&...args);
+        iterator InsertAt(Node *leaf, int pos, Value &&value); // puts value into the leaf at pos
+        Node *SplitNode(Node *node); // moves the upper half of a full node to a new right sibling
+        void EraseAt(Node *node, int pos);
+        void Rebalance(Node *node); // fixes nodes with too few values from node up to the root
+        void BorrowFromLeft(Node *left, Node *node);
+        void BorrowFromRight(Node *node, Node *right);
+        void MergeNodes(Node *left, Node *right); // moves right and the separator into left and frees right
+        void Append(Value &&value); // puts value after the largest one; value must be greater than every key
+        // erases every value the predicate holds for in one O(n) pass: the rest move in order into new nodes
+        template<typename Pred>
+        size_type RemoveIf(Pred pred);
+    };
+
+    // Iterator
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    Value &BTree<Key, Value, KeyOfValue, Compare>::Iterator::operator*() const {
+        return node_->value(position_);
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    Value *BTree<Key, Value, KeyOfValue, Compare>::Iterator::operator->() const {
+        return &operator*();
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    typename BTree<Key, Value, KeyOfValue, Compare>::Iterator &BTree<Key, Value, KeyOfValue, Compare>::Iterator::operator++() {
+        if (!node_->leaf_) {
+            node_ = Leftmost(Child(node_, position_ + 1));
+            position_ = 0;
+            return *this;
+        }
+        ++position_;
+        if (position_ < node_->count_) {
+            return *this;
+        }
+        // лист закончился - поднимаемся, пока не найдем родителя, у которого еще есть значения правее
+        Node *node = node_;
+        int position = position_;
+        while (position == node->count_ && node->parent_ != nullptr) {
+            position = node->position_;
+            node = node->parent_;
+        }
+        if (position < node->count_) {
+            node_ = node;
+            position_ = position;
+        } // иначе это был последний элемент и итератор остается в позиции end()
+        return *this;
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    typename BTree<Key, Value, KeyOfValue, Compare>::Iterator BTree<Key, Value, KeyOfValue, Compare>::Iterator::operator++(int) {
+        Iterator tmp = *this;
+        ++(*this);
+        return tmp;
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    typename BTree<Key, Value, KeyOfValue, Compare>::Iterator &BTree<Key, Value, KeyOfValue, Compare>::Iterator::operator--() {
+        if (!node_->leaf_) {
+            node_ = Rightmost(Child(node_, position_));
+            position_ = node_->count_ - 1;
+            return *this;
+        }
+        --position_;
+        while (position_ < 0 && node_->parent_ != nullptr) {
+            position_ = node_->position_ - 1;
+            node_ = node_->parent_;
+        }
+        return *this;
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    typename BTree<Key, Value, KeyOfValue, Compare>::Iterator BTree<Key, Value, KeyOfValue, Compare>::Iterator::operator--(int) {
+        Iterator tmp = *this;
+        --(*this);
+        return tmp;
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    bool BTree<Key, Value, KeyOfValue, Compare>::Iterator::operator==(const Iterator &other) const {
+        return node_ == other.node_ && position_ == other.position_;
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    bool BTree<Key, Value, KeyOfValue, Compare>::Iterator::operator!=(const Iterator &other) const {
+        return !(*this == other);
+    }
+
+    // BTree constructors
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    BTree<Key, Value, KeyOfValue, Compare>::BTree(const BTree &other) : comp_(other.comp_) {
+        root_ = CopySubtree(other.root_, nullptr);
+        size_ = other.size_;
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    BTree<Key, Value, KeyOfValue, Compare>::BTree(BTree &&other) noexcept
+            : comp_(std::move(other.comp_)), root_(std::exchange(other.root_, nullptr)),
+              size_(std::exchange(other.size_, 0)) {}
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    BTree<Key, Value, KeyOfValue, Compare>::~BTree() {
+        clear();
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    BTree<Key, Value, KeyOfValue, Compare> &BTree<Key, Value, KeyOfValue, Compare>::operator=(const BTree &other) {
+        if (this != &other) {
+            BTree tmp(other);
+            *this = std::move(tmp);
+        }
+        return *this;
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    BTree<Key, Value, KeyOfValue, Compare> &BTree<Key, Value, KeyOfValue, Compare>::operator=(BTree &&other) noexcept {
+        if (this != &other) {
+            clear();
+            comp_ = std::move(other.comp_);
+            root_ = std::exchange(other.root_, nullptr);
+            size_ = std::exchange(other.size_, 0);
+        }
+        return *this;
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    typename BTree<Key, Value, KeyOfValue, Compare>::Iterator BTree<Key, Value, KeyOfValue, Compare>::begin() {
+        if (root_ == nullptr) {
+            return Iterator();
+        }
+        return Iterator(Leftmost(root_), 0);
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    typename BTree<Key, Value, KeyOfValue, Compare>::Iterator BTree<Key, Value, KeyOfValue, Compare>::end() {
+        if (root_ == nullptr) {
+            return Iterator();
+        }
+        Node *last = Rightmost(root_);
+        return Iterator(last, last->count_);
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    typename BTree<Key, Value, KeyOfValue, Compare>::ConstIterator BTree<Key, Value, KeyOfValue, Compare>::cbegin() const {
+        return const_cast<BTree *>(this)->begin();
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    typename BTree<Key, Value, KeyOfValue, Compare>::ConstIterator BTree<Key, Value, KeyOfValue, Compare>::cend() const {
+        return const_cast<BTree *>(this)->end();
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    void BTree<Key, Value, KeyOfValue, Compare>::clear() {
+        FreeSubtree(root_);
+        root_ = nullptr;
+        size_ = 0;
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    bool BTree<Key, Value, KeyOfValue, Compare>::empty() {
+        return size_ == 0;
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    size_t BTree<Key, Value, KeyOfValue, Compare>::size() {
+        return size_;
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    size_t BTree<Key, Value, KeyOfValue, Compare>::max_size() {
+        return std::numeric_limits<size_type>::max() / sizeof(Value);
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    void BTree<Key, Value, KeyOfValue, Compare>::erase(Iterator pos) {
+        if (root_ == nullptr || pos.node_ == nullptr || pos.position_ >= pos.node_->count_) {
+            return;
+        }
+        EraseAt(pos.node_, pos.position_);
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    typename BTree<Key, Value, KeyOfValue, Compare>::Iterator BTree<Key, Value, KeyOfValue, Compare>::erase(Iterator first, Iterator last) {
+        size_type count = 0;
+        for (Iterator it = first; it != last; ++it) {
+            ++count;
+        }
+        if (count == 0) {
+            return last;
+        }
+        if (count * 4 < size_) {
+            // удаляем с конца: перед last всегда стоит очередное удаляемое значение, а last ищется заново по ключу,
+            // потому что после каждого удаления значения переезжают
+            if (last == end()) {
+                for (; count != 0; --count) {
+                    Iterator it = --end();
+                    EraseAt(it.node_, it.position_);
+                }
+                return end();
+            }
+            Key last_key = KeyOfValue()(*last);
+            for (; count != 0; --count) {
+                Iterator it = --LowerBound(last_key);
+                EraseAt(it.node_, it.position_);
+            }
+            return LowerBound(last_key);
+        }
+        // длинный диапазон: один проход вместо count поисков и перебалансировок
+        const Value *first_value = &*first;
+        size_type before = 0; // values kept before the range - the index of the returned element
+        bool passed = false;
+        RemoveIf([&](const Value &value) {
+            if (&value == first_value) {
+                passed = true;
+            }
+            if (!passed) {
+                ++before;
+                return false;
+            }
+            if (count != 0) {
+                --count;
+                return true;
+            }
+            return false;
+        });
+        Iterator result = begin();
+        for (; before != 0; --before) {
+            ++result;
+        }
+        return result;
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    void BTree<Key, Value, KeyOfValue, Compare>::swap(BTree &other) {
+        std::swap(comp_, other.comp_);
+        std::swap(root_, other.root_);
+        std::swap(size_, other.size_);
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    void BTree<Key, Value, KeyOfValue, Compare>::merge(BTree &other) {
+        if (this == &other) {
+            return;
+        }
+        // значения переезжают по одному; то, что не поместилось (ключ уже есть), собирается в новое дерево для other
+        BTree rest;
+        rest.comp_ = other.comp_;
+        for (Iterator it = other.begin(); it != other.end(); ++it) {
+            const Key &key = KeyOfValue()(*it);
+            // EmplaceUnique забирает значение, только если вставка произошла
+            if (!EmplaceUnique(key, std::move(*it)).second) {
+                rest.EmplaceUnique(key, std::move(*it));
+            }
+        }
+        other = std::move(rest);
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    bool BTree<Key, Value, KeyOfValue, Compare>::contains(const Key &key) {
+        return Find(key) != end();
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    template<typename K, typename C, typename>
+    bool BTree<Key, Value, KeyOfValue, Compare>::contains(const K &key) {
+        return Find(key) != end();
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    size_t BTree<Key, Value, KeyOfValue, Compare>::count(const Key &key) {
+        return contains(key) ? 1 : 0;
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    template<typename K, typename C, typename>
+    size_t BTree<Key, Value, KeyOfValue, Compare>::count(const K &key) {
+        return contains(key) ? 1 : 0;
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    Compare BTree<Key, Value, KeyOfValue, Compare>::key_comp() const {
+        return comp_;
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    typename BTree<Key, Value, KeyOfValue, Compare>::Iterator BTree<Key, Value, KeyOfValue, Compare>::lower_bound(const Key &key) {
+        return LowerBound(key);
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    template<typename K, typename C, typename>
+    typename BTree<Key, Value, KeyOfValue, Compare>::Iterator BTree<Key, Value, KeyOfValue, Compare>::lower_bound(const K &key) {
+        return LowerBound(key);
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    typename BTree<Key, Value, KeyOfValue, Compare>::Iterator BTree<Key, Value, KeyOfValue, Compare>::upper_bound(const Key &key) {
+        return UpperBound(key);
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    template<typename K, typename C, typename>
+    typename BTree<Key, Value, KeyOfValue, Compare>::Iterator BTree<Key, Value, KeyOfValue, Compare>::upper_bound(const K &key) {
+        return UpperBound(key);
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    std::pair<typename BTree<Key, Value, KeyOfValue, Compare>::Iterator, typename BTree<Key, Value, KeyOfValue, Compare>::Iterator>
+    BTree<Key, Value, KeyOfValue, Compare>::equal_range(const Key &key) {
+        return EqualRange(key);
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    template<typename K, typename C, typename>
+    std::pair<typename BTree<Key, Value, KeyOfValue, Compare>::Iterator, typename BTree<Key, Value, KeyOfValue, Compare>::Iterator>
+    BTree<Key, Value, KeyOfValue, Compare>::equal_range(const K &key) {
+        return EqualRange(key);
+    }
+
+    // Node helpers
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    typename BTree<Key, Value, KeyOfValue, Compare>::Node *BTree<Key, Value, KeyOfValue, Compare>::NewNode(bool leaf) {
+        // узлы выровнены по кэш-линии, чтобы значения узла занимали как можно меньше линий
+        if (leaf) {
+            void *memory = ::operator new(sizeof(Node), std::align_val_t(kCacheLine));
+            return ::new (memory) Node();
+        }
+        void *memory = ::operator new(sizeof(InternalNode), std::align_val_t(kCacheLine));
+        Node *node = ::new (memory) InternalNode();
+        node->leaf_ = false;
+        return node;
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    void BTree<Key, Value, KeyOfValue, Compare>::FreeNode(BTree::Node *node) {
+        // значения узла к этому моменту уже разрушены или перенесены, сами Node/InternalNode тривиальны
+        ::operator delete(static_cast<void *>(node), std::align_val_t(kCacheLine));
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    typename BTree<Key, Value, KeyOfValue, Compare>::Node *BTree<Key, Value, KeyOfValue, Compare>::Leftmost(BTree::Node *node) {
+        while (!node->leaf_) {
+            node = Child(node, 0);
+        }
+        return node;
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    typename BTree<Key, Value, KeyOfValue, Compare>::Node *BTree<Key, Value, KeyOfValue, Compare>::Rightmost(BTree::Node *node) {
+        while (!node->leaf_) {
+            node = Child(node, node->count_);
+        }
+        return node;
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    void BTree<Key, Value, KeyOfValue, Compare>::Relocate(BTree::Node *from, int from_pos, BTree::Node *to, int to_pos) {
+        ::new (static_cast<void *>(to->Slot(to_pos))) Value(std::move(from->value(from_pos)));
+        from->value(from_pos).~Value();
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    void BTree<Key, Value, KeyOfValue, Compare>::SetChild(BTree::Node *parent, int i, BTree::Node *child) {
+        Child(parent, i) = child;
+        child->parent_ = parent;
+        child->position_ = static_cast<unsigned short>(i);
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    typename BTree<Key, Value, KeyOfValue, Compare>::Node *BTree<Key, Value, KeyOfValue, Compare>::CopySubtree(BTree::Node *node,
+                                                                                                    BTree::Node *parent) {
+        if (node == nullptr) {
+            return nullptr;
+        }
+        Node *copy = NewNode(node->leaf_);
+        copy->parent_ = parent;
+        copy->position_ = node->position_;
+        try {
+            for (; copy->count_ < node->count_; ++copy->count_) {
+                ::new (static_cast<void *>(copy->Slot(copy->count_))) Value(node->value(copy->count_));
+            }
+            if (!node->leaf_) {
+                for (int i = 0; i <= node->count_; ++i) {
+                    Child(copy, i) = CopySubtree(Child(node, i), copy);
+                }
+            }
+        } catch (...) {
+            FreeSubtree(copy); // дети, которые не успели скопироваться, равны nullptr
+            throw;
+        }
+        return copy;
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    void BTree<Key, Value, KeyOfValue, Compare>::FreeSubtree(BTree::Node *node) {
+        if (node == nullptr) {
+            return;
+        }
+        if (!node->leaf_) {
+            for (int i = 0; i <= node->count_; ++i) {
+                FreeSubtree(Child(node, i));
+            }
+        }
+        for (int i = 0; i < node->count_; ++i) {
+            node->value(i).~Value();
+        }
+        FreeNode(node);
+    }
+
+    // Search
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    template<typename K>
+    int BTree<Key, Value, KeyOfValue, Compare>::LowerBoundIn(BTree::Node *node, const K &key) const {
+        int low = 0;
+        int high = node->count_;
+        while (low < high) {
+            int mid = (low + high) / 2;
+            if (comp_(KeyOf(node, mid), key)) {
+                low = mid + 1;
+            } else {
+                high = mid;
+            }
+        }
+        return low;
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    template<typename K>
+    int BTree<Key, Value, KeyOfValue, Compare>::UpperBoundIn(BTree::Node *node, const K &key) const {
+        int low = 0;
+        int high = node->count_;
+        while (low < high) {
+            int mid = (low + high) / 2;
+            if (comp_(key, KeyOf(node, mid))) {
+                high = mid;
+            } else {
+                low = mid + 1;
+            }
+        }
+        return low;
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    template<typename K>
+    typename BTree<Key, Value, KeyOfValue, Compare>::Iterator BTree<Key, Value, KeyOfValue, Compare>::Find(const K &key) {
+        Node *node = root_;
+        while (node != nullptr) {
+            int pos = LowerBoundIn(node, key);
+            if (pos < node->count_ && !comp_(key, KeyOf(node, pos))) {
+                return Iterator(node, pos);
+            }
+            node = node->leaf_ ? nullptr : Child(node, pos);
+        }
+        return end();
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    template<typename K>
+    typename BTree<Key, Value, KeyOfValue, Compare>::Iterator BTree<Key, Value, KeyOfValue, Compare>::LowerBound(const K &key) {
+        Iterator result = end();
+        Node *node = root_;
+        while (node != nullptr) {
+            int pos = LowerBoundIn(node, key);
+            if (pos < node->count_) {
+                result = Iterator(node, pos);
+            }
+            node = node->leaf_ ? nullptr : Child(node, pos);
+        }
+        return result;
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    template<typename K>
+    typename BTree<Key, Value, KeyOfValue, Compare>::Iterator BTree<Key, Value, KeyOfValue, Compare>::UpperBound(const K &key) {
+        Iterator result = end();
+        Node *node = root_;
+        while (node != nullptr) {
+            int pos = UpperBoundIn(node, key);
+            if (pos < node->count_) {
+                result = Iterator(node, pos);
+            }
+            node = node->leaf_ ? nullptr : Child(node, pos);
+        }
+        return result;
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    template<typename K>
+    std::pair<typename BTree<Key, Value, KeyOfValue, Compare>::Iterator, typename BTree<Key, Value, KeyOfValue, Compare>::Iterator>
+    BTree<Key, Value, KeyOfValue, Compare>::EqualRange(const K &key) {
+        Iterator lower = LowerBound(key);
+        if (lower == end() || comp_(key, KeyOfValue()(*lower))) {
+            return std::make_pair(lower, lower); // ключа нет - диапазон пустой
+        }
+        Iterator upper = lower;
+        ++upper;
+        return std::make_pair(lower, upper);
+    }
+
+    // Insert
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    template<typename... Args>
+    std::pair<typename BTree<Key, Value, KeyOfValue, Compare>::Iterator, bool>
+    BTree<Key, Value, KeyOfValue, Compare>::EmplaceUnique(const Key &key, Args &&...args) {
+        if (root_ == nullptr) {
+            root_ = NewNode(true);
+        }
+        Node *node = root_;
+        while (true) {
+            int pos = LowerBoundIn(node, key);
+            if (pos < node->count_ && !comp_(key, KeyOf(node, pos))) {
+                return std::make_pair(Iterator(node, pos), false); // в дереве не может быть два одинаковых ключа
+            }
+            if (node->leaf_) {
+                // значение строится до того, как элементы узлов начнут переезжать: args могут ссылаться на них
+                Value value(std::forward<Args>(args)...);
+                return std::make_pair(InsertAt(node, pos, std::move(value)), true);
+            }
+            node = Child(node, pos);
+        }
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    typename BTree<Key, Value, KeyOfValue, Compare>::Iterator BTree<Key, Value, KeyOfValue, Compare>::InsertAt(BTree::Node *leaf, int pos,
+                                                                                                 Value &&value) {
+        if (leaf->count_ == kMaxValues) {
+            int mid = leaf->count_ / 2;
+            Node *sibling = SplitNode(leaf);
+            if (pos > mid) {
+                leaf = sibling;
+                pos -= mid + 1;
+            }
+        }
+        for (int i = leaf->count_; i > pos; --i) {
+            Relocate(leaf, i - 1, leaf, i);
+        }
+        ::new (static_cast<void *>(leaf->Slot(pos))) Value(std::move(value));
+        ++leaf->count_;
+        ++size_;
+        return Iterator(leaf, pos);
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    typename BTree<Key, Value, KeyOfValue, Compare>::Node *BTree<Key, Value, KeyOfValue, Compare>::SplitNode(BTree::Node *node) {
+        if (node->parent_ == nullptr) {
+            // делится корень - дерево растет на уровень вверх
+            Node *root = NewNode(false);
+            SetChild(root, 0, node);
+            root_ = root;
+        } else if (node->parent_->count_ == kMaxValues) {
+            SplitNode(node->parent_); // после этого node мог переехать к новому соседу родителя
+        }
+        Node *parent = node->parent_;
+        Node *sibling = NewNode(node->leaf_);
+        int mid = node->count_ / 2;
+        int moved = node->count_ - mid - 1;
+        for (int i = 0; i < moved; ++i) {
+            Relocate(node, mid + 1 + i, sibling, i);
+        }
+        if (!node->leaf_) {
+            for (int i = 0; i <= moved; ++i) {
+                SetChild(sibling, i, Child(node, mid + 1 + i));
+            }
+        }
+        sibling->count_ = static_cast<unsigned short>(moved);
+
+        // медиана уходит в родителя, справа от нее встает sibling
+        int at = node->position_;
+        for (int i = parent->count_; i > at; --i) {
+            Relocate(parent, i - 1, parent, i);
+            SetChild(parent, i + 1, Child(parent, i));
+        }
+        Relocate(node, mid, parent, at);
+        SetChild(parent, at + 1, sibling);
+        ++parent->count_;
+        node->count_ = static_cast<unsigned short>(mid);
+        return sibling;
+    }
+
+    // Erase
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    void BTree<Key, Value, KeyOfValue, Compare>::EraseAt(BTree::Node *node, int pos) {
+        node->value(pos).~Value();
+        if (!node->leaf_) {
+            // на место значения встает предшественник - последнее значение самого правого листа левого поддерева
+            Node *leaf = Rightmost(Child(node, pos));
+            Relocate(leaf, leaf->count_ - 1, node, pos);
+            node = leaf;
+        } else {
+            for (int i = pos + 1; i < node->count_; ++i) {
+                Relocate(node, i, node, i - 1);
+            }
+        }
+        --node->count_;
+        --size_;
+        Rebalance(node);
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    void BTree<Key, Value, KeyOfValue, Compare>::Rebalance(BTree::Node *node) {
+        while (node != root_ && node->count_ < kMinValues) {
+            Node *parent = node->parent_;
+            int at = node->position_;
+            Node *left = at > 0 ? Child(parent, at - 1) : nullptr;
+            Node *right = at < parent->count_ ? Child(parent, at + 1) : nullptr;
+            if (left != nullptr && left->count_ > kMinValues) {
+                BorrowFromLeft(left, node);
+                return;
+            }
+            if (right != nullptr && right->count_ > kMinValues) {
+                BorrowFromRight(node, right);
+                return;
+            }
+            // у соседей нет лишних значений - склеиваем узел с соседом, в родителе становится на одно значение меньше
+            if (left != nullptr) {
+                MergeNodes(left, node);
+            } else {
+                MergeNodes(node, right);
+            }
+            node = parent;
+        }
+        if (root_->count_ == 0) {
+            Node *old_root = root_;
+            root_ = old_root->leaf_ ? nullptr : Child(old_root, 0);
+            if (root_ != nullptr) {
+                root_->parent_ = nullptr;
+                root_->position_ = 0;
+            }
+            FreeNode(old_root);
+        }
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    void BTree<Key, Value, KeyOfValue, Compare>::BorrowFromLeft(BTree::Node *left, BTree::Node *node) {
+        Node *parent = node->parent_;
+        int separator = left->position_;
+        for (int i = node->count_; i > 0; --i) {
+            Relocate(node, i - 1, node, i);
+        }
+        if (!node->leaf_) {
+            for (int i = node->count_ + 1; i > 0; --i) {
+                SetChild(node, i, Child(node, i - 1));
+            }
+            SetChild(node, 0, Child(left, left->count_));
+        }
+        Relocate(parent, separator, node, 0);
+        Relocate(left, left->count_ - 1, parent, separator);
+        --left->count_;
+        ++node->count_;
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    void BTree<Key, Value, KeyOfValue, Compare>::BorrowFromRight(BTree::Node *node, BTree::Node *right) {
+        Node *parent = node->parent_;
+        int separator = node->position_;
+        Relocate(parent, separator, node, node->count_);
+        if (!node->leaf_) {
+            SetChild(node, node->count_ + 1, Child(right, 0));
+        }
+        ++node->count_;
+        Relocate(right, 0, parent, separator);
+        for (int i = 1; i < right->count_; ++i) {
+            Relocate(right, i, right, i - 1);
+        }
+        if (!right->leaf_) {
+            for (int i = 0; i < right->count_; ++i) {
+                SetChild(right, i, Child(right, i + 1));
+            }
+        }
+        --right->count_;
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    void BTree<Key, Value, KeyOfValue, Compare>::MergeNodes(BTree::Node *left, BTree::Node *right) {
+        Node *parent = left->parent_;
+        int separator = left->position_;
+        Relocate(parent, separator, left, left->count_);
+        for (int i = 0; i < right->count_; ++i) {
+            Relocate(right, i, left, left->count_ + 1 + i);
+        }
+        if (!left->leaf_) {
+            for (int i = 0; i <= right->count_; ++i) {
+                SetChild(left, left->count_ + 1 + i, Child(right, i));
+            }
+        }
+        left->count_ = static_cast<unsigned short>(left->count_ + 1 + right->count_);
+        for (int i = separator + 1; i < parent->count_; ++i) {
+            Relocate(parent, i, parent, i - 1);
+            SetChild(parent, i, Child(parent, i + 1));
+        }
+        --parent->count_;
+        FreeNode(right);
+    }
+
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    void BTree<Key, Value, KeyOfValue, Compare>::Append(Value &&value) {
+        if (root_ == nullptr) {
+            root_ = NewNode(true);
+        }
+        Node *leaf = Rightmost(root_);
+        InsertAt(leaf, leaf->count_, std::move(value));
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+    template<typename Pred>
+    size_t BTree<Key, Value, KeyOfValue, Compare>::RemoveIf(Pred pred) {
+        BTree kept;
+        kept.comp_ = comp_;
+        size_type removed = 0;
+        Iterator it = begin();
+        try {
+            for (; it != end(); ++it) {
+                if (pred(*it)) {
+                    ++removed;
+                } else {
+                    kept.Append(std::move(*it));
+                }
+            }
+        } catch (...) {
+            // предикат бросил исключение - непроверенные значения остаются в дереве вместе с уже оставленными
+            for (; it != end(); ++it) {
+                kept.Append(std::move(*it));
+            }
+            *this = std::move(kept);
+            throw;
+        }
+        *this = std::move(kept);
+        return removed;
+    }
+} // namespace s21
+
+#endif //SRC_BTREE_H
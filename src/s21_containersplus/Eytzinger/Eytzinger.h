@@ -0,0 +1,210 @@
+#ifndef SRC_EYTZINGER_H
+#define SRC_EYTZINGER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <utility>
+
+// Раскладка Эйтцингера: отсортированные элементы лежат в массиве в порядке обхода дерева поиска в ширину.
+// Корень - ячейка 1, сыновья ячейки k - 2k и 2k + 1, ячейка 0 не используется. Верхние уровни дерева, которые
+// нужны каждому поиску, лежат рядом в начале массива, а шаг поиска k = 2k + (keys[k] < key) не ветвится.
+// Массив выровнен по кэш-линии. Если sizeof(T) - степень двойки меньше 64, то 64 / sizeof(T) потомков ячейки k
+// на несколько уровней ниже лежат в одной линии с ячейки k * 64 / sizeof(T) - ее поиск подгружает заранее, пока
+// сравнивает текущий уровень. Для других размеров эти потомки делят линию с соседями или сама ячейка занимает
+// линию целиком, и подгрузка не делается.
+
+namespace s21 {
+    template <typename T>
+    class EytzingerArray {
+    public:
+        static constexpr size_t kCacheLine = 64;
+
+        EytzingerArray() = default;
+        // copies count sorted elements from first into the layout
+        template <typename InputIt>
+        EytzingerArray(InputIt first, size_t count);
+        EytzingerArray(const EytzingerArray &other);
+        EytzingerArray(EytzingerArray &&other) noexcept;
+        EytzingerArray &operator=(const EytzingerArray &other);
+        EytzingerArray &operator=(EytzingerArray &&other) noexcept;
+        ~EytzingerArray();
+
+        size_t size() const { return size_; };
+        const T &operator[](size_t k) const { return data_[k]; }; // k from 1 to size()
+        const T *data() const { return data_; }; // the cell 0 is data()[0]
+        void swap(EytzingerArray &other) noexcept;
+
+        // cell of the first element not less than key (by comp) or 0 if there is none; no branches but the loop
+        template <typename K, typename Compare>
+        size_t LowerBound(const K &key, const Compare &comp) const;
+        // cell of the first element greater than key or 0
+        template <typename K, typename Compare>
+        size_t UpperBound(const K &key, const Compare &comp) const;
+
+        // cells in sorted order: First() is the smallest element, Next() of the largest one is 0
+        static size_t First(size_t size);
+        static size_t Next(size_t k, size_t size);
+
+    private:
+        // only then a cache line holds a whole number of cells and starts at a cell
+        static constexpr bool kPrefetch = (sizeof(T) & (sizeof(T) - 1)) == 0 && sizeof(T) < kCacheLine;
+        // сколько ячеек помещается в кэш-линию: у ячейки k через log2(kPrefetchStride) поколений
+        // ровно столько потомков, и они лежат подряд с ячейки k * kPrefetchStride, то есть с начала линии
+        static constexpr size_t kPrefetchStride = kPrefetch ? kCacheLine / sizeof(T) : 1;
+
+        void Prefetch(size_t k) const {
+            if constexpr (kPrefetch) {
+                __builtin_prefetch(reinterpret_cast<const char *>(data_) + k * kPrefetchStride * sizeof(T));
+            }
+        };
+        void Allocate(size_t size);
+        void Destroy();
+        // the last cell of the search path ends with a run of "greater or equal" steps cut off by the shift
+        static size_t Resolve(size_t k) { return k >> (__builtin_ctzll(~static_cast<unsigned long long>(k)) + 1); };
+
+        T *data_ = nullptr; // size_ + 1 cells, the cell 0 is never constructed
+        size_t size_ = 0;
+    };
+
+    template <typename T>
+    template <typename InputIt>
+    EytzingerArray<T>::EytzingerArray(InputIt first, size_t count) {
+        Allocate(count);
+        size_t built = 0;
+        try {
+            for (size_t k = First(count); k != 0; k = Next(k, count), ++first, ++built) {
+                ::new (static_cast<void *>(data_ + k)) T(*first);
+            }
+        } catch (...) {
+            // построенные ячейки - первые built по порядку обхода
+            for (size_t k = First(count); built != 0; k = Next(k, count), --built) {
+                data_[k].~T();
+            }
+            ::operator delete(data_, std::align_val_t(kCacheLine));
+            throw;
+        }
+    }
+
+    template <typename T>
+    EytzingerArray<T>::EytzingerArray(const EytzingerArray &other) {
+        Allocate(other.size_);
+        size_t k = 1;
+        try {
+            for (; k <= size_; ++k) {
+                ::new (static_cast<void *>(data_ + k)) T(other.data_[k]);
+            }
+        } catch (...) {
+            while (--k != 0) {
+                data_[k].~T();
+            }
+            ::operator delete(data_, std::align_val_t(kCacheLine));
+            throw;
+        }
+    }
+
+    template <typename T>
+    EytzingerArray<T>::EytzingerArray(EytzingerArray &&other) noexcept
+            : data_(std::exchange(other.data_, nullptr)), size_(std::exchange(other.size_, 0)) {}
+
+    template <typename T>
+    EytzingerArray<T> &EytzingerArray<T>::operator=(const EytzingerArray &other) {
+        if (this != &other) {
+            EytzingerArray copy(other);
+            swap(copy);
+        }
+        return *this;
+    }
+
+    template <typename T>
+    EytzingerArray<T> &EytzingerArray<T>::operator=(EytzingerArray &&other) noexcept {
+        if (this != &other) {
+            EytzingerArray tmp(std::move(other));
+            swap(tmp);
+        }
+        return *this;
+    }
+
+    template <typename T>
+    EytzingerArray<T>::~EytzingerArray() {
+        Destroy();
+    }
+
+    template <typename T>
+    void EytzingerArray<T>::swap(EytzingerArray &other) noexcept {
+        std::swap(data_, other.data_);
+        std::swap(size_, other.size_);
+    }
+
+    template <typename T>
+    template <typename K, typename Compare>
+    size_t EytzingerArray<T>::LowerBound(const K &key, const Compare &comp) const {
+        size_t k = 1;
+        while (k <= size_) {
+            Prefetch(k);
+            k = 2 * k + static_cast<size_t>(comp(data_[k], key));
+        }
+        return Resolve(k);
+    }
+
+    template <typename T>
+    template <typename K, typename Compare>
+    size_t EytzingerArray<T>::UpperBound(const K &key, const Compare &comp) const {
+        size_t k = 1;
+        while (k <= size_) {
+            Prefetch(k);
+            k = 2 * k + static_cast<size_t>(!comp(key, data_[k]));
+        }
+        return Resolve(k);
+    }
+
+    template <typename T>
+    size_t EytzingerArray<T>::First(size_t size) {
+        if (size == 0) {
+            return 0;
+        }
+        size_t k = 1;
+        while (2 * k <= size) {
+            k *= 2;
+        }
+        return k;
+    }
+
+    template <typename T>
+    size_t EytzingerArray<T>::Next(size_t k, size_t size) {
+        if (2 * k + 1 <= size) {
+            // самый левый узел правого поддерева
+            k = 2 * k + 1;
+            while (2 * k <= size) {
+                k *= 2;
+            }
+            return k;
+        }
+        // поднимаемся, пока идем из правого сына; корень (k = 1) дает 0 - конец обхода
+        while (k & 1) {
+            k >>= 1;
+        }
+        return k >> 1;
+    }
+
+    template <typename T>
+    void EytzingerArray<T>::Allocate(size_t size) {
+        data_ = static_cast<T *>(::operator new((size + 1) * sizeof(T), std::align_val_t(kCacheLine)));
+        size_ = size;
+    }
+
+    template <typename T>
+    void EytzingerArray<T>::Destroy() {
+        if (data_ == nullptr) {
+            return;
+        }
+        for (size_t k = 1; k <= size_; ++k) {
+            data_[k].~T();
+        }
+        ::operator delete(data_, std::align_val_t(kCacheLine));
+        data_ = nullptr;
+        size_ = 0;
+    }
+} // namespace s21
+
+#endif //SRC_EYTZINGER_H
@@ -0,0 +1,89 @@
+#ifndef SRC_HASHGROUP_H
+#define SRC_HASHGROUP_H
+
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+// HashGroup - группа подряд идущих управляющих байтов HashTable, которая сравнивается с искомым байтом разом.
+// На x86 группа - 16 байт и одно сравнение SSE2, на остальных платформах (в том числе arm64) - 8 байт,
+// сравниваемых как одно 64-битное число (SWAR). Результат - маска найденных слотов группы.
+
+namespace s21 {
+    // управляющий байт слота: 0..127 - слот занят (младшие 7 бит хеша ключа), остальное - служебные значения
+    enum HashCtrl : signed char {
+        kCtrlEmpty = -128, // слот свободен и никогда не был частью заполненной группы - поиск здесь останавливается
+        kCtrlDeleted = -2, // элемент удален из заполненной группы - поиск идет дальше
+        kCtrlEnd = -1, // байт после последнего слота - на нем останавливается итератор
+    };
+
+    // found slots of a group; Shift turns the index of the lowest set bit into a slot index
+    template<int Shift>
+    class GroupMask {
+    public:
+        explicit GroupMask(uint64_t mask) : mask_(mask) {};
+
+        explicit operator bool() const { return mask_ != 0; };
+        int Lowest() const { return __builtin_ctzll(mask_) >> Shift; }; // index of the first found slot
+        void ClearLowest() { mask_ &= mask_ - 1; };
+
+    private:
+        uint64_t mask_;
+    };
+
+#if defined(__SSE2__)
+    class HashGroup {
+    public:
+        static constexpr size_t kWidth = 16;
+
+        // ctrl must be aligned to kWidth
+        explicit HashGroup(const signed char *ctrl) : ctrl_(_mm_load_si128(reinterpret_cast<const __m128i *>(ctrl))) {};
+
+        // slots whose control byte is h2
+        GroupMask<0> Match(signed char h2) const {
+            return GroupMask<0>(static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), ctrl_))));
+        };
+        GroupMask<0> MatchEmpty() const { return Match(kCtrlEmpty); };
+        // у свободных и удаленных слотов выставлен знаковый бит, у занятых - нет (kCtrlEnd в группы не попадает)
+        GroupMask<0> MatchEmptyOrDeleted() const {
+            return GroupMask<0>(static_cast<uint32_t>(_mm_movemask_epi8(ctrl_)));
+        };
+
+    private:
+        __m128i ctrl_;
+    };
+#else
+    class HashGroup {
+    public:
+        static constexpr size_t kWidth = 8;
+
+        explicit HashGroup(const signed char *ctrl) : ctrl_(0) {
+            // байт i группы попадает в биты 8i..8i+7 независимо от порядка байтов платформы
+            for (size_t i = 0; i < kWidth; ++i) {
+                ctrl_ |= static_cast<uint64_t>(static_cast<unsigned char>(ctrl[i])) << (8 * i);
+            }
+        };
+
+        // slots whose control byte is h2; a slot right above a real match may be reported too, so the caller
+        // compares the keys anyway
+        GroupMask<3> Match(signed char h2) const {
+            uint64_t x = ctrl_ ^ (kLsbs * static_cast<unsigned char>(h2));
+            return GroupMask<3>((x - kLsbs) & ~x & kMsbs);
+        };
+        // kCtrlEmpty = 0b10000000, kCtrlDeleted = 0b11111110: у свободного слота старший бит есть, а бит 1 - нет
+        GroupMask<3> MatchEmpty() const { return GroupMask<3>((ctrl_ & (~ctrl_ << 6)) & kMsbs); };
+        GroupMask<3> MatchEmptyOrDeleted() const { return GroupMask<3>(ctrl_ & kMsbs); };
+
+    private:
+        static constexpr uint64_t kLsbs = 0x0101010101010101ULL;
+        static constexpr uint64_t kMsbs = 0x8080808080808080ULL;
+
+        uint64_t ctrl_;
+    };
+#endif
+} // namespace s21
+
+#endif //SRC_HASHGROUP_H
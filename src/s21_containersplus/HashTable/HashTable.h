@@ -0,0 +1,601 @@
+#ifndef SRC_HASHTABLE_H
+#define SRC_HASHTABLE_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <new>
+#include <utility>
+
+#include "../../s21_containers/AVLTree/KeyOfValue.h"
+#include "HashGroup.h"
+
+// HashTable - хеш-таблица с открытой адресацией в духе Swiss table для unordered_map и unordered_set.
+// Значения лежат в одном массиве слотов, рядом - массив управляющих байтов (по байту на слот). Старшие биты хеша
+// выбирают группу слотов, младшие 7 бит записываются в управляющий байт. Поиск сравнивает 7 бит хеша сразу
+// со всей группой (HashGroup) и сравнивает ключи только у совпавших слотов; свободный слот в группе
+// означает, что дальше искать не нужно. Группы перебираются с шагом 1, 2, 3... - так обходятся все группы.
+// Таблица заполняется не больше чем на 7/8, после этого она перестраивается вдвое большей.
+// Удаление оставляет метку kCtrlDeleted только если группа была заполнена целиком (через нее мог пройти
+// поиск другого ключа), иначе слот сразу становится свободным.
+// Перестройка таблицы делает итераторы и ссылки недействительными, удаление - только на удаленный элемент.
+
+namespace s21 {
+    template<typename Key, typename Value, typename KeyOfValue, typename Hash = std::hash<Key>,
+             typename KeyEqual = std::equal_to<Key>>
+    class HashTable {
+    public:
+        class Iterator;
+        class ConstIterator;
+
+        using key_type = Key;
+        using value_type = Value;
+        using reference = value_type &;
+        using const_reference = const value_type &;
+        using iterator = Iterator;
+        using const_iterator = ConstIterator;
+        using size_type = size_t;
+        using hasher = Hash;
+        using key_equal = KeyEqual;
+
+        class Iterator {
+        public:
+            friend class HashTable<Key, Value, KeyOfValue, Hash, KeyEqual>;
+            using iterator_category = std::forward_iterator_tag;
+            using difference_type = std::ptrdiff_t;
+            using value_type = Value;
+            using pointer = Value *;
+            using reference = Value &;
+
+            Iterator() = default;
+            Iterator(const signed char *ctrl, Value *slot) : ctrl_(ctrl), slot_(slot) {};
+
+            reference operator*() const { return *slot_; };
+            pointer operator->() const { return slot_; };
+            Iterator &operator++();
+            Iterator operator++(int);
+            bool operator==(const Iterator &other) const { return slot_ == other.slot_; };
+            bool operator!=(const Iterator &other) const { return slot_ != other.slot_; };
+
+        protected:
+            void SkipFree(); // moves forward to the first occupied slot or to the end
+
+            const signed char *ctrl_ = nullptr;
+            Value *slot_ = nullptr;
+        };
+
+        class ConstIterator : public Iterator {
+        public:
+            ConstIterator() : Iterator() {};
+            ConstIterator(const Iterator &other) : Iterator(other) {};
+            const_reference operator*() const { return Iterator::operator*(); };
+            const value_type *operator->() const { return Iterator::operator->(); };
+        };
+
+        HashTable() = default; // default constructor
+        // creates an empty table with room for at least bucket_count slots
+        explicit HashTable(size_type bucket_count, const Hash &hash = Hash(), const KeyEqual &equal = KeyEqual());
+        HashTable(const HashTable &other); // copy constructor
+        HashTable(HashTable &&other) noexcept; // move constructor
+        ~HashTable(); // destructor
+        HashTable &operator=(const HashTable &other);
+        HashTable &operator=(HashTable &&other) noexcept;
+
+        iterator begin();
+        iterator end();
+        const_iterator cbegin() const;
+        const_iterator cend() const;
+
+        void clear(); // destroys the elements and keeps the slots
+        bool empty() const; // checks whether the container is empty
+        size_type size() const; // returns the number of elements
+        size_type max_size() const; // returns the maximum possible number of elements
+        iterator erase(iterator pos); // erases element at pos and returns the iterator to the next one
+        size_type erase(const Key &key); // erases the element with key and returns how many were erased (0 or 1)
+        template<typename K, typename H = Hash, typename E = KeyEqual, typename = typename H::is_transparent,
+                 typename = typename E::is_transparent>
+        size_type erase(const K &key) { return EraseKey(key); };
+        void swap(HashTable &other); // swaps the contents
+        void merge(HashTable &other); // moves the elements of other whose keys are not here yet
+        bool contains(const Key &key) const;
+        template<typename K, typename H = Hash, typename E = KeyEqual, typename = typename H::is_transparent,
+                 typename = typename E::is_transparent>
+        bool contains(const K &key) const { return FindIndex(key, HashOf(key)) != capacity_; };
+        size_type count(const Key &key) const; // returns the number of elements with key (0 or 1)
+        template<typename K, typename H = Hash, typename E = KeyEqual, typename = typename H::is_transparent,
+                 typename = typename E::is_transparent>
+        size_type count(const K &key) const { return contains(key) ? 1 : 0; };
+        hasher hash_function() const;
+        key_equal key_eq() const;
+
+        size_type bucket_count() const; // returns the number of slots
+        float load_factor() const; // returns the average number of elements per slot
+        float max_load_factor() const; // the table grows when it would get fuller than this (7/8)
+        void rehash(size_type count); // sets the number of slots to at least count and rebuilds the table
+        void reserve(size_type count); // makes room for count elements without rebuilding the table
+
+    protected:
+        static constexpr size_type kWidth = HashGroup::kWidth;
+        static constexpr size_type kMinCapacity = 16;
+
+        signed char *ctrl_ = nullptr; // capacity_ control bytes, then kCtrlEnd
+        Value *slots_ = nullptr;
+        size_type capacity_ = 0; // 0 or a power of two not less than kMinCapacity
+        size_type size_ = 0;
+        size_type growth_left_ = 0; // how many free slots can still be taken before the table has to be rebuilt
+        Hash hash_;
+        KeyEqual equal_;
+
+        static const Key &KeyOf(const Value &value) { return KeyOfValue()(value); }
+        static signed char H2(size_t hash) { return static_cast<signed char>(hash & 0x7F); }
+        static size_type MaxFill(size_type capacity) { return capacity - capacity / 8; }
+        static size_type CapacityFor(size_type count); // the least capacity that holds count elements
+        template<typename K>
+        size_t HashOf(const K &key) const; // hash of key with its bits mixed
+        iterator MakeIterator(size_type index); // iterator to the slot, end() for capacity_
+
+        template<typename K>
+        size_type FindIndex(const K &key, size_t hash) const; // slot of the element with key or capacity_
+        template<typename K>
+        iterator Find(const K &key);
+        template<typename K>
+        size_type EraseKey(const K &key);
+        size_type FindFreeSlot(size_t hash) const; // first empty or deleted slot on the probe sequence of hash
+        // returns the element with key and whether the insertion took place;
+        // the value is built from args (its key must be key) only if the key is not in the table yet
+        template<typename... Args>
+        std::pair<iterator, bool> EmplaceUnique(const Key &key, Args &&...args);
+        void EraseAt(size_type index);
+        void GrowForInsert(); // drops the deleted slots or doubles the table when no free slot is left
+        void Resize(size_type new_capacity); // moves the elements to a table of new_capacity slots
+        void Allocate(size_type capacity); // creates empty storage of capacity slots
+        void DestroyElements();
+        void FreeStorage();
+    };
+
+    // Iterator
+    template<typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual>
+    void HashTable<Key, Value, KeyOfValue, Hash, KeyEqual>::Iterator::SkipFree() {
+        // у kCtrlEmpty и kCtrlDeleted значения меньше kCtrlEnd, у занятых слотов - больше
+        while (*ctrl_ < kCtrlEnd) {
+            ++ctrl_;
+            ++slot_;
+        }
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual>
+    typename HashTable<Key, Value, KeyOfValue, Hash, KeyEqual>::Iterator &
+    HashTable<Key, Value, KeyOfValue, Hash, KeyEqual>::Iterator::operator++() {
+        ++ctrl_;
+        ++slot_;
+        SkipFree();
+        return *this;
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual>
+    typename HashTable<Key, Value, KeyOfValue, Hash, KeyEqual>::Iterator
+    HashTable<Key, Value, KeyOfValue, Hash, KeyEqual>::Iterator::operator++(int) {
+        Iterator tmp = *this;
+        ++(*this);
+        return tmp;
+    }
+
+    // HashTable constructors
+    template<typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual>
+    HashTable<Key, Value, KeyOfValue, Hash, KeyEqual>::HashTable(size_type bucket_count, const Hash &hash,
+                                                                 const KeyEqual &equal)
+            : hash_(hash), equal_(equal) {
+        rehash(bucket_count);
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual>
+    HashTable<Key, Value, KeyOfValue, Hash, KeyEqual>::HashTable(const HashTable &other)
+            : hash_(other.hash_), equal_(other.equal_) {
+        if (other.capacity_ == 0) {
+            return;
+        }
+        // раскладка слотов копируется как есть - хеши заново не считаются
+        Allocate(other.capacity_);
+        std::memcpy(ctrl_, other.ctrl_, capacity_);
+        for (size_type i = 0; i < capacity_; ++i) {
+            if (ctrl_[i] >= 0) {
+                ::new (static_cast<void *>(slots_ + i)) Value(other.slots_[i]);
+            }
+        }
+        size_ = other.size_;
+        growth_left_ = other.growth_left_;
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual>
+    HashTable<Key, Value, KeyOfValue, Hash, KeyEqual>::HashTable(HashTable &&other) noexcept
+            : ctrl_(std::exchange(other.ctrl_, nullptr)), slots_(std::exchange(other.slots_, nullptr)),
+              capacity_(std::exchange(other.capacity_, 0)), size_(std::exchange(other.size_, 0)),
+              growth_left_(std::exchange(other.growth_left_, 0)), hash_(std::move(other.hash_)),
+              equal_(std::move(other.equal_)) {}
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual>
+    HashTable<Key, Value, KeyOfValue, Hash, KeyEqual>::~HashTable() {
+        FreeStorage();
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual>
+    HashTable<Key, Value, KeyOfValue, Hash, KeyEqual> &
+    HashTable<Key, Value, KeyOfValue, Hash, KeyEqual>::operator=(const HashTable &other) {
+        if (this != &other) {
+            HashTable tmp(other);
+            *this = std::move(tmp);
+        }
+        return *this;
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual>
+    HashTable<Key, Value, KeyOfValue, Hash, KeyEqual> &
+    HashTable<Key, Value, KeyOfValue, Hash, KeyEqual>::operator=(HashTable &&other) noexcept {
+        if (this != &other) {
+            FreeStorage();
+            ctrl_ = std::exchange(other.ctrl_, nullptr);
+            slots_ = std::exchange(other.slots_, nullptr);
+            capacity_ = std::exchange(other.capacity_, 0);
+            size_ = std::exchange(other.size_, 0);
+            growth_left_ = std::exchange(other.growth_left_, 0);
+            hash_ = std::move(other.hash_);
+            equal_ = std::move(other.equal_);
+        }
+        return *this;
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual>
+    typename HashTable<Key, Value, KeyOfValue, Hash, KeyEqual>::Iterator HashTable<Key, Value, KeyOfValue, Hash, KeyEqual>::begin() {
+        if (capacity_ == 0) {
+            return Iterator();
+        }
+        Iterator it(ctrl_, slots_);
+        it.SkipFree();
+        return it;
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual>
+    typename HashTable<Key, Value, KeyOfValue, Hash, KeyEqual>::Iterator HashTable<Key, Value, KeyOfValue, Hash, KeyEqual>::end() {
+        return MakeIterator(capacity_);
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual>
+    typename HashTable<Key, Value, KeyOfValue, Hash, KeyEqual>::ConstIterator
+    HashTable<Key, Value, KeyOfValue, Hash, KeyEqual>::cbegin() const {
+        return const_cast<HashTable *>(this)->begin();
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual>
+    typename HashTable<Key, Value, KeyOfValue, Hash, KeyEqual>::ConstIterator
+    HashTable<Key, Value, KeyOfValue, Hash, KeyEqual>::cend() const {
+        return const_cast<HashTable *>(this)->end();
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual>
+    void HashTable<Key, Value, KeyOfValue, Hash, KeyEqual>::clear() {
+        if (capacity_ == 0) {
+            return;
+        }
+        DestroyElements();
+        std::memset(ctrl_, kCtrlEmpty, capacity_);
+        size_ = 0;
+        growth_left_ = MaxFill(capacity_);
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual>
+    bool HashTable<Key, Value, KeyOfValue, Hash, KeyEqual>::empty() const {
+        return size_ == 0;
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual>
+    size_t HashTable<Key, Value, KeyOfValue, Hash, KeyEqual>::size() const {
+        return size_;
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual>
+    size_t HashTable<Key, Value, KeyOfValue, Hash, KeyEqual>::max_size() const {
+        return std::numeric_limits<size_type>::max() / (sizeof(Value) + 1);
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual>
+    typename HashTable<Key, Value, KeyOfValue, Hash, KeyEqual>::Iterator
+    HashTable<Key, Value, KeyOfValue, Hash, KeyEqual>::erase(Iterator pos) {
+        if (pos.slot_ == nullptr || pos == end()) {
+            return end();
+        }
+        Iterator next = pos;
+        ++next;
+        EraseAt(static_cast<size_type>(pos.slot_ - slots_));
+        return next;
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual>
+    size_t HashTable<Key, Value, KeyOfValue, Hash, KeyEqual>::erase(const Key &key) {
+        return EraseKey(key);
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual>
+    void HashTable<Key, Value, KeyOfValue, Hash, KeyEqual>::swap(HashTable &other) {
+        std::swap(ctrl_, other.ctrl_);
+        std::swap(slots_, other.slots_);
+        std::swap(capacity_, other.capacity_);
+        std::swap(size_, other.size_);
+        std::swap(growth_left_, other.growth_left_);
+        std::swap(hash_, other.hash_);
+        std::swap(equal_, other.equal_);
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual>
+    void HashTable<Key, Value, KeyOfValue, Hash, KeyEqual>::merge(HashTable &other) {
+        if (this == &other) {
+            return;
+        }
+        reserve(size_ + other.size_);
+        // удаление из other не двигает остальные его элементы, поэтому обход other не сбивается
+        for (Iterator it = other.begin(); it != other.end(); ++it) {
+            // EmplaceUnique забирает значение, только если вставка произошла
+            if (EmplaceUnique(KeyOf(*it), std::move(*it)).second) {
+                other.EraseAt(static_cast<size_type>(it.slot_ - other.slots_));
+            }
+        }
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual>
+    bool HashTable<Key, Value, KeyOfValue, Hash, KeyEqual>::contains(const Key &key) const {
+        return FindIndex(key, HashOf(key)) != capacity_;
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual>
+    size_t HashTable<Key, Value, KeyOfValue, Hash, KeyEqual>::count(const Key &key) const {
+        return contains(key) ? 1 : 0;
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual>
+    Hash HashTable<Key, Value, KeyOfValue, Hash, KeyEqual>::hash_function() const {
+        return hash_;
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual>
+    KeyEqual HashTable<Key, Value, KeyOfValue, Hash, KeyEqual>::key_eq() const {
+        return equal_;
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual>
+    size_t HashTable<Key, Value, KeyOfValue, Hash, KeyEqual>::bucket_count() const {
+        return capacity_;
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual>
+    float HashTable<Key, Value, KeyOfValue, Hash, KeyEqual>::load_factor() const {
+        return capacity_ == 0 ? 0.0f : static_cast<float>(size_) / static_cast<float>(capacity_);
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual>
+    float HashTable<Key, Value, KeyOfValue, Hash, KeyEqual>::max_load_factor() const {
+        return 0.875f;
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual>
+    void HashTable<Key, Value, KeyOfValue, Hash, KeyEqual>::rehash(size_type count) {
+        if (count == 0 && size_ == 0) {
+            FreeStorage();
+            return;
+        }
+        size_type capacity = kMinCapacity;
+        while (capacity < count) {
+            capacity *= 2;
+        }
+        // слотов не может стать меньше, чем нужно для уже лежащих элементов
+        Resize(std::max(capacity, CapacityFor(size_)));
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual>
+    void HashTable<Key, Value, KeyOfValue, Hash, KeyEqual>::reserve(size_type count) {
+        if (count > size_ + growth_left_) {
+            Resize(CapacityFor(count));
+        }
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual>
+    size_t HashTable<Key, Value, KeyOfValue, Hash, KeyEqual>::CapacityFor(size_type count) {
+        size_type capacity = kMinCapacity;
+        while (MaxFill(capacity) < count) {
+            capacity *= 2;
+        }
+        return capacity;
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual>
+    template<typename K>
+    size_t HashTable<Key, Value, KeyOfValue, Hash, KeyEqual>::HashOf(const K &key) const {
+        // std::hash для целых чисел - само число; перемешиваем биты (финал MurmurHash3), чтобы и группа,
+        // и 7 бит в управляющем байте зависели от всего ключа
+        uint64_t hash = static_cast<uint64_t>(hash_(key));
+        hash ^= hash >> 33;
+        hash *= 0xff51afd7ed558ccdULL;
+        hash ^= hash >> 33;
+        hash *= 0xc4ceb9fe1a85ec53ULL;
+        hash ^= hash >> 33;
+        return static_cast<size_t>(hash);
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual>
+    typename HashTable<Key, Value, KeyOfValue, Hash, KeyEqual>::Iterator
+    HashTable<Key, Value, KeyOfValue, Hash, KeyEqual>::MakeIterator(size_type index) {
+        if (capacity_ == 0) {
+            return Iterator();
+        }
+        return Iterator(ctrl_ + index, slots_ + index);
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual>
+    template<typename K>
+    size_t HashTable<Key, Value, KeyOfValue, Hash, KeyEqual>::FindIndex(const K &key, size_t hash) const {
+        if (capacity_ == 0) {
+            return capacity_;
+        }
+        size_type group_mask = capacity_ / kWidth - 1;
+        size_type group = (hash >> 7) & group_mask;
+        signed char h2 = H2(hash);
+        for (size_type step = 1;; ++step) {
+            HashGroup ctrl(ctrl_ + group * kWidth);
+            for (auto match = ctrl.Match(h2); match; match.ClearLowest()) {
+                size_type index = group * kWidth + static_cast<size_type>(match.Lowest());
+                if (equal_(key, KeyOf(slots_[index]))) {
+                    return index;
+                }
+            }
+            // таблица заполнена не больше чем на 7/8, так что группа со свободным слотом найдется всегда
+            if (ctrl.MatchEmpty()) {
+                return capacity_;
+            }
+            group = (group + step) & group_mask;
+        }
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual>
+    template<typename K>
+    typename HashTable<Key, Value, KeyOfValue, Hash, KeyEqual>::Iterator HashTable<Key, Value, KeyOfValue, Hash, KeyEqual>::Find(const K &key) {
+        return MakeIterator(FindIndex(key, HashOf(key)));
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual>
+    template<typename K>
+    size_t HashTable<Key, Value, KeyOfValue, Hash, KeyEqual>::EraseKey(const K &key) {
+        size_type index = FindIndex(key, HashOf(key));
+        if (index == capacity_) {
+            return 0;
+        }
+        EraseAt(index);
+        return 1;
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual>
+    size_t HashTable<Key, Value, KeyOfValue, Hash, KeyEqual>::FindFreeSlot(size_t hash) const {
+        size_type group_mask = capacity_ / kWidth - 1;
+        size_type group = (hash >> 7) & group_mask;
+        for (size_type step = 1;; ++step) {
+            auto free = HashGroup(ctrl_ + group * kWidth).MatchEmptyOrDeleted();
+            if (free) {
+                return group * kWidth + static_cast<size_type>(free.Lowest());
+            }
+            group = (group + step) & group_mask;
+        }
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual>
+    template<typename... Args>
+    std::pair<typename HashTable<Key, Value, KeyOfValue, Hash, KeyEqual>::Iterator, bool>
+    HashTable<Key, Value, KeyOfValue, Hash, KeyEqual>::EmplaceUnique(const Key &key, Args &&...args) {
+        size_t hash = HashOf(key);
+        size_type index = FindIndex(key, hash);
+        if (index != capacity_) {
+            return std::make_pair(MakeIterator(index), false);
+        }
+        if (growth_left_ == 0) {
+            // значение строится до перестройки таблицы: args могут ссылаться на ее элементы
+            Value value(std::forward<Args>(args)...);
+            GrowForInsert();
+            index = FindFreeSlot(hash);
+            ::new (static_cast<void *>(slots_ + index)) Value(std::move(value));
+        } else {
+            index = FindFreeSlot(hash);
+            ::new (static_cast<void *>(slots_ + index)) Value(std::forward<Args>(args)...);
+        }
+        // удаленный слот занимается без расхода growth_left_: он и так считался занятым
+        if (ctrl_[index] == kCtrlEmpty) {
+            --growth_left_;
+        }
+        ctrl_[index] = H2(hash);
+        ++size_;
+        return std::make_pair(MakeIterator(index), true);
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual>
+    void HashTable<Key, Value, KeyOfValue, Hash, KeyEqual>::EraseAt(size_type index) {
+        slots_[index].~Value();
+        // если в группе есть свободный слот, ни один поиск через нее не проходил - метка удаления не нужна
+        if (HashGroup(ctrl_ + index / kWidth * kWidth).MatchEmpty()) {
+            ctrl_[index] = kCtrlEmpty;
+            ++growth_left_;
+        } else {
+            ctrl_[index] = kCtrlDeleted;
+        }
+        --size_;
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual>
+    void HashTable<Key, Value, KeyOfValue, Hash, KeyEqual>::GrowForInsert() {
+        if (capacity_ == 0) {
+            Resize(kMinCapacity);
+        } else if (size_ * 32 <= capacity_ * 25) {
+            Resize(capacity_); // место съели метки удаления - перестраиваем таблицу того же размера без них
+        } else {
+            Resize(capacity_ * 2);
+        }
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual>
+    void HashTable<Key, Value, KeyOfValue, Hash, KeyEqual>::Resize(size_type new_capacity) {
+        signed char *old_ctrl = ctrl_;
+        Value *old_slots = slots_;
+        size_type old_capacity = capacity_;
+        Allocate(new_capacity);
+        for (size_type i = 0; i < old_capacity; ++i) {
+            if (old_ctrl[i] >= 0) {
+                size_t hash = HashOf(KeyOf(old_slots[i]));
+                size_type index = FindFreeSlot(hash);
+                ::new (static_cast<void *>(slots_ + index)) Value(std::move(old_slots[i]));
+                old_slots[i].~Value();
+                ctrl_[index] = H2(hash);
+            }
+        }
+        growth_left_ = MaxFill(capacity_) - size_;
+        if (old_capacity != 0) {
+            ::operator delete(old_ctrl, std::align_val_t(kWidth));
+            ::operator delete(old_slots, std::align_val_t(alignof(Value)));
+        }
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual>
+    void HashTable<Key, Value, KeyOfValue, Hash, KeyEqual>::Allocate(size_type capacity) {
+        // управляющих байтов на группу больше, чем слотов: место под kCtrlEnd, размер кратен ширине группы
+        ctrl_ = static_cast<signed char *>(::operator new(capacity + kWidth, std::align_val_t(kWidth)));
+        slots_ = static_cast<Value *>(::operator new(capacity * sizeof(Value), std::align_val_t(alignof(Value))));
+        std::memset(ctrl_, kCtrlEmpty, capacity);
+        std::memset(ctrl_ + capacity, kCtrlEnd, kWidth);
+        capacity_ = capacity;
+        growth_left_ = MaxFill(capacity);
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual>
+    void HashTable<Key, Value, KeyOfValue, Hash, KeyEqual>::DestroyElements() {
+        for (size_type i = 0; i < capacity_; ++i) {
+            if (ctrl_[i] >= 0) {
+                slots_[i].~Value();
+            }
+        }
+    }
+
+    template<typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual>
+    void HashTable<Key, Value, KeyOfValue, Hash, KeyEqual>::FreeStorage() {
+        if (capacity_ == 0) {
+            return;
+        }
+        DestroyElements();
+        ::operator delete(ctrl_, std::align_val_t(kWidth));
+        ::operator delete(slots_, std::align_val_t(alignof(Value)));
+        ctrl_ = nullptr;
+        slots_ = nullptr;
+        capacity_ = 0;
+        size_ = 0;
+        growth_left_ = 0;
+    }
+
+} // namespace s21
+
+#endif //SRC_HASHTABLE_H
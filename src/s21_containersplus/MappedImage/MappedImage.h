@@ -0,0 +1,367 @@
+#ifndef SRC_MAPPEDIMAGE_H
+#define SRC_MAPPEDIMAGE_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Двоичный образ отсортированного контейнера (map или set) и его отображение в память.
+// Формат: заголовок ImageHeader, с kImageAlign - массив ключей по порядку, со следующей границы kImageAlign -
+// массив значений той же длины (у set его нет). Ключи и значения записаны как есть (байты trivially copyable
+// типов), поэтому после mmap бинарный поиск идет прямо по файлу и ничего не разбирается.
+// Образ читается только на машине с тем же порядком байтов и теми же размерами типов - это проверяется при открытии.
+// Контрольная сумма данных проверяется отдельно через Verify(): ради нее пришлось бы прочитать весь файл,
+// а открытие должно занимать миллисекунды независимо от размера.
+
+namespace s21 {
+    struct ImageHeader {
+        char magic_[8]; // kImageMagic
+        uint32_t version_; // kImageVersion
+        uint32_t endian_; // kImageEndian as written by the machine that made the image
+        uint32_t key_size_;
+        uint32_t value_size_; // 0 for a set
+        uint64_t count_; // number of elements
+        uint64_t keys_offset_;
+        uint64_t values_offset_;
+        uint64_t data_size_; // bytes from keys_offset_ to the end of the file
+        uint64_t checksum_; // of those bytes
+        uint64_t header_checksum_; // of the fields above
+    };
+
+    constexpr char kImageMagic[8] = {'S', '2', '1', 'I', 'M', 'A', 'G', 'E'};
+    constexpr uint32_t kImageVersion = 1;
+    constexpr uint32_t kImageEndian = 0x01020304;
+    constexpr uint64_t kImageAlign = 64; // the arrays start at cache line boundaries
+
+    // FNV-1a по 64-битным словам: на порядок быстрее побайтового и ловит порчу и обрезку файла
+    class ImageChecksum {
+    public:
+        void Update(const void *data, size_t size);
+        uint64_t Finish(); // hashes the unfinished word padded with zeros
+
+    private:
+        static constexpr uint64_t kPrime = 0x100000001b3ULL;
+
+        void Mix(uint64_t word) { state_ = (state_ ^ word) * kPrime; };
+
+        uint64_t state_ = 0xcbf29ce484222325ULL;
+        unsigned char tail_[8] = {};
+        size_t tail_size_ = 0;
+    };
+
+    inline void ImageChecksum::Update(const void *data, size_t size) {
+        const unsigned char *bytes = static_cast<const unsigned char *>(data);
+        while (size > 0 && tail_size_ != 0) {
+            tail_[tail_size_++] = *bytes++;
+            --size;
+            if (tail_size_ == sizeof(tail_)) {
+                uint64_t word;
+                std::memcpy(&word, tail_, sizeof(word));
+                Mix(word);
+                tail_size_ = 0;
+            }
+        }
+        for (; size >= sizeof(uint64_t); size -= sizeof(uint64_t), bytes += sizeof(uint64_t)) {
+            uint64_t word;
+            std::memcpy(&word, bytes, sizeof(word));
+            Mix(word);
+        }
+        std::memcpy(tail_, bytes, size);
+        tail_size_ += size;
+    }
+
+    inline uint64_t ImageChecksum::Finish() {
+        if (tail_size_ != 0) {
+            std::memset(tail_ + tail_size_, 0, sizeof(tail_) - tail_size_);
+            uint64_t word;
+            std::memcpy(&word, tail_, sizeof(word));
+            Mix(word);
+            tail_size_ = 0;
+        }
+        return state_;
+    }
+
+    inline uint64_t HeaderChecksum(const ImageHeader &header) {
+        ImageChecksum checksum;
+        checksum.Update(&header, offsetof(ImageHeader, header_checksum_));
+        return checksum.Finish();
+    }
+
+    // writes the image of count elements taken from [first, last) in order; KeyOf and ValueOf get an element
+    // and return references to its key and value (ValueOf is not called if T is void, as for a set).
+    // The image is written to a unique temporary file next to path, synced to disk and renamed over path only when
+    // complete; then the directory is synced too, so after a crash path holds either the old image or the new one.
+    // Keys and values are written as raw bytes: for types with padding the padding bytes get into the image and
+    // its checksum, so two images of the same elements may differ (each one still reads back correctly)
+    template <typename Key, typename T, typename It, typename KeyOf, typename ValueOf>
+    void WriteImage(const std::string &path, It first, It last, size_t count, KeyOf key_of, ValueOf value_of);
+
+    // file with an image mapped read-only into memory; throws std::runtime_error if the file can not be opened
+    // or is not an image of elements of these sizes
+    class MappedImage {
+    public:
+        MappedImage() = default;
+        MappedImage(const std::string &path, size_t key_size, size_t value_size);
+        MappedImage(const MappedImage &other) = delete;
+        MappedImage(MappedImage &&other) noexcept;
+        MappedImage &operator=(const MappedImage &other) = delete;
+        MappedImage &operator=(MappedImage &&other) noexcept;
+        ~MappedImage();
+
+        size_t Size() const { return header_ == nullptr ? 0 : static_cast<size_t>(header_->count_); };
+        const void *Keys() const { return Data(header_ == nullptr ? 0 : header_->keys_offset_); };
+        const void *Values() const { return Data(header_ == nullptr ? 0 : header_->values_offset_); };
+        bool Verify() const; // reads the whole file and compares the checksum of the data
+        void swap(MappedImage &other) noexcept;
+
+    private:
+        const void *Data(uint64_t offset) const {
+            return header_ == nullptr ? nullptr : reinterpret_cast<const unsigned char *>(header_) + offset;
+        };
+        [[noreturn]] static void Fail(const std::string &path, const char *reason);
+
+        const ImageHeader *header_ = nullptr; // start of the mapping
+        size_t length_ = 0;
+    };
+
+    namespace image_detail {
+        // буферизованная запись в FILE с подсчетом контрольной суммы всего, что идет после заголовка
+        class ImageWriter {
+        public:
+            explicit ImageWriter(std::FILE *file) : file_(file), buffer_(1 << 20) {};
+
+            void Append(const void *data, size_t size);
+            void PadTo(uint64_t alignment); // appends zeros up to the next multiple of alignment
+            bool Flush();
+            uint64_t Written() const { return written_; };
+            uint64_t Checksum() { return checksum_.Finish(); };
+
+        private:
+            std::FILE *file_;
+            std::vector<unsigned char> buffer_;
+            size_t used_ = 0;
+            uint64_t written_ = 0;
+            bool failed_ = false;
+            ImageChecksum checksum_;
+        };
+
+        inline void ImageWriter::Append(const void *data, size_t size) {
+            checksum_.Update(data, size);
+            written_ += size;
+            const unsigned char *bytes = static_cast<const unsigned char *>(data);
+            while (size > 0) {
+                if (used_ == buffer_.size()) {
+                    Flush();
+                }
+                size_t part = std::min(size, buffer_.size() - used_);
+                std::memcpy(buffer_.data() + used_, bytes, part);
+                used_ += part;
+                bytes += part;
+                size -= part;
+            }
+        }
+
+        inline void ImageWriter::PadTo(uint64_t alignment) {
+            static const unsigned char zeros[kImageAlign] = {};
+            while (written_ % alignment != 0) {
+                Append(zeros, static_cast<size_t>(std::min<uint64_t>(alignment - written_ % alignment, kImageAlign)));
+            }
+        }
+
+        inline bool ImageWriter::Flush() {
+            if (used_ != 0 && std::fwrite(buffer_.data(), 1, used_, file_) != used_) {
+                failed_ = true;
+            }
+            used_ = 0;
+            return !failed_;
+        }
+
+        constexpr uint64_t AlignUp(uint64_t value) { return (value + kImageAlign - 1) / kImageAlign * kImageAlign; }
+
+        // makes the rename of an entry of the directory of path durable
+        inline bool SyncDirectory(const std::string &path) {
+            size_t slash = path.rfind('/');
+            std::string directory = slash == std::string::npos ? "." : slash == 0 ? "/" : path.substr(0, slash);
+            int fd = ::open(directory.c_str(), O_RDONLY | O_DIRECTORY);
+            if (fd < 0) {
+                return false;
+            }
+            bool ok = ::fsync(fd) == 0;
+            return ::close(fd) == 0 && ok;
+        }
+
+        // true if the arrays of the header lie inside a file of length bytes.
+        // Контрольная сумма заголовка не защищает от подделки, поэтому границы проверяются делением, а не
+        // умножением count_ на размер: огромный count_ не может переполниться и пройти проверку
+        inline bool ArraysFit(const ImageHeader &header, uint64_t key_size, uint64_t value_size, uint64_t length) {
+            if (header.keys_offset_ % kImageAlign != 0 || header.values_offset_ % kImageAlign != 0 ||
+                header.keys_offset_ < sizeof(ImageHeader) || header.keys_offset_ > length ||
+                header.data_size_ != length - header.keys_offset_ ||
+                header.count_ > (length - header.keys_offset_) / key_size) {
+                return false;
+            }
+            if (header.values_offset_ < header.keys_offset_ + header.count_ * key_size || header.values_offset_ > length) {
+                return false;
+            }
+            return value_size == 0 || header.count_ <= (length - header.values_offset_) / value_size;
+        }
+    } // namespace image_detail
+
+    template <typename Key, typename T, typename It, typename KeyOf, typename ValueOf>
+    void WriteImage(const std::string &path, It first, It last, size_t count, KeyOf key_of, ValueOf value_of) {
+        static_assert(std::is_trivially_copyable<Key>::value, "image keys must be trivially copyable");
+        constexpr bool kHasValues = !std::is_void<T>::value;
+        size_t value_size = 0;
+        if constexpr (kHasValues) {
+            static_assert(std::is_trivially_copyable<T>::value, "image values must be trivially copyable");
+            value_size = sizeof(T);
+        }
+
+        ImageHeader header{};
+        std::memcpy(header.magic_, kImageMagic, sizeof(kImageMagic));
+        header.version_ = kImageVersion;
+        header.endian_ = kImageEndian;
+        header.key_size_ = static_cast<uint32_t>(sizeof(Key));
+        header.value_size_ = static_cast<uint32_t>(value_size);
+        header.count_ = count;
+        header.keys_offset_ = image_detail::AlignUp(sizeof(ImageHeader));
+        header.values_offset_ = header.keys_offset_ + image_detail::AlignUp(count * sizeof(Key));
+
+        // у каждого писателя свой временный файл, поэтому два одновременных write_image не пишут в один
+        std::string tmp_path = path + ".XXXXXX";
+        int fd = ::mkstemp(&tmp_path[0]);
+        std::FILE *file = fd < 0 ? nullptr : ::fdopen(fd, "wb");
+        if (file == nullptr) {
+            if (fd >= 0) {
+                ::close(fd);
+                std::remove(tmp_path.c_str());
+            }
+            throw std::runtime_error("Can not create image file " + tmp_path);
+        }
+        static_cast<void>(::fchmod(fd, 0644)); // mkstemp создает файл с правами 0600
+        // место заголовка пока заполнено нулями: он пишется последним, когда известна контрольная сумма
+        unsigned char zeros[image_detail::AlignUp(sizeof(ImageHeader))] = {};
+        bool ok = std::fwrite(zeros, 1, sizeof(zeros), file) == sizeof(zeros);
+
+        image_detail::ImageWriter writer(file);
+        size_t written = 0;
+        for (It it = first; it != last && written < count; ++it, ++written) {
+            const Key &key = key_of(*it);
+            writer.Append(&key, sizeof(Key));
+        }
+        writer.PadTo(kImageAlign);
+        if constexpr (kHasValues) {
+            size_t left = written;
+            for (It it = first; left != 0; ++it, --left) {
+                const T &value = value_of(*it);
+                writer.Append(&value, sizeof(T));
+            }
+            writer.PadTo(kImageAlign);
+        }
+        ok = writer.Flush() && ok && written == count;
+        header.data_size_ = writer.Written();
+        header.checksum_ = writer.Checksum();
+        header.header_checksum_ = HeaderChecksum(header);
+        ok = ok && std::fseek(file, 0, SEEK_SET) == 0 && std::fwrite(&header, sizeof(header), 1, file) == 1;
+        // данные должны дойти до диска раньше переименования, иначе после сбоя на месте старого образа
+        // может оказаться обрезанный
+        ok = ok && std::fflush(file) == 0 && ::fsync(::fileno(file)) == 0;
+        ok = std::fclose(file) == 0 && ok;
+        if (!ok || std::rename(tmp_path.c_str(), path.c_str()) != 0) {
+            std::remove(tmp_path.c_str());
+            throw std::runtime_error("Can not write image file " + path);
+        }
+        if (!image_detail::SyncDirectory(path)) {
+            throw std::runtime_error("Can not sync the directory of image file " + path);
+        }
+    }
+
+    inline MappedImage::MappedImage(const std::string &path, size_t key_size, size_t value_size) {
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            Fail(path, "can not open the file");
+        }
+        struct stat info{};
+        if (::fstat(fd, &info) != 0 || static_cast<uint64_t>(info.st_size) < sizeof(ImageHeader)) {
+            ::close(fd);
+            Fail(path, "the file is too short");
+        }
+        length_ = static_cast<size_t>(info.st_size);
+        void *memory = ::mmap(nullptr, length_, PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd); // отображение живет и без дескриптора
+        if (memory == MAP_FAILED) {
+            Fail(path, "mmap failed");
+        }
+        header_ = static_cast<const ImageHeader *>(memory);
+
+        const char *reason = nullptr;
+        const ImageHeader &header = *header_;
+        if (std::memcmp(header.magic_, kImageMagic, sizeof(kImageMagic)) != 0) {
+            reason = "not an image file";
+        } else if (header.version_ != kImageVersion) {
+            reason = "unsupported image version";
+        } else if (header.endian_ != kImageEndian) {
+            reason = "the image was written with another byte order";
+        } else if (header.header_checksum_ != HeaderChecksum(header)) {
+            reason = "the image header is damaged";
+        } else if (header.key_size_ != key_size || header.value_size_ != value_size) {
+            reason = "the image holds elements of other types";
+        } else if (!image_detail::ArraysFit(header, key_size, value_size, length_)) {
+            reason = "the image file is truncated";
+        }
+        if (reason != nullptr) {
+            ::munmap(const_cast<ImageHeader *>(header_), length_);
+            header_ = nullptr;
+            Fail(path, reason);
+        }
+    }
+
+    inline MappedImage::MappedImage(MappedImage &&other) noexcept
+            : header_(std::exchange(other.header_, nullptr)), length_(std::exchange(other.length_, 0)) {}
+
+    inline MappedImage &MappedImage::operator=(MappedImage &&other) noexcept {
+        if (this != &other) {
+            MappedImage tmp(std::move(other));
+            swap(tmp);
+        }
+        return *this;
+    }
+
+    inline MappedImage::~MappedImage() {
+        if (header_ != nullptr) {
+            ::munmap(const_cast<ImageHeader *>(header_), length_);
+        }
+    }
+
+    inline bool MappedImage::Verify() const {
+        if (header_ == nullptr) {
+            return true;
+        }
+        ImageChecksum checksum;
+        checksum.Update(Data(header_->keys_offset_), static_cast<size_t>(header_->data_size_));
+        return checksum.Finish() == header_->checksum_;
+    }
+
+    inline void MappedImage::swap(MappedImage &other) noexcept {
+        std::swap(header_, other.header_);
+        std::swap(length_, other.length_);
+    }
+
+    inline void MappedImage::Fail(const std::string &path, const char *reason) {
+        throw std::runtime_error("Can not open image " + path + ": " + reason);
+    }
+} // namespace s21
+
+#endif //SRC_MAPPEDIMAGE_H
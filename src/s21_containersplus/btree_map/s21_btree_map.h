@@ -0,0 +1,218 @@
+#ifndef SRC_S21_BTREE_MAP_H
+#define SRC_S21_BTREE_MAP_H
+
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <tuple>
+#include <vector>
+
+#include "../BTree/BTree.h"
+
+// btree_map - тот же map, но на B-дереве: пары ключ-значение лежат в узлах плотными массивами,
+// поэтому поиск по большому индексу делает в разы меньше промахов кэша.
+// Любое изменение дерева делает итераторы и ссылки на элементы недействительными.
+
+namespace s21 {
+    template <typename Key, typename T, typename Compare = std::less<Key>>
+    class btree_map : public BTree<Key, std::pair<const Key, T>, PairFirstKey<std::pair<const Key, T>>, Compare> {
+        using tree_type = BTree<Key, std::pair<const Key, T>, PairFirstKey<std::pair<const Key, T>>, Compare>;
+
+    public:
+        using key_type = Key;
+        using mapped_type = T;
+        using value_type = std::pair<const key_type, mapped_type>;
+        using reference = value_type &;
+        using const_reference = const value_type &;
+        using iterator = typename tree_type::Iterator;
+        using const_iterator = typename tree_type::ConstIterator;
+        using size_type = size_t;
+
+        btree_map() : tree_type(){};
+        btree_map(std::initializer_list<value_type> const &items);
+        template <typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category>
+        btree_map(InputIt first, InputIt last);
+        btree_map(const btree_map &other) : tree_type(other){};
+        btree_map(btree_map &&other) noexcept : tree_type(std::move(other)){};
+        btree_map &operator=(btree_map &&other) noexcept;
+        btree_map &operator=(const btree_map &other);
+        ~btree_map() = default;
+
+        iterator find(const Key &key) { return tree_type::Find(key); };
+        template <typename K, typename C = Compare, typename = typename C::is_transparent>
+        iterator find(const K &key) { return tree_type::Find(key); };
+        T &at(const Key &key);
+        template <typename K, typename C = Compare, typename = typename C::is_transparent>
+        T &at(const K &key);
+        T &operator[](const Key &key);
+        // inserts node and returns iterator to where the element is in the container and bool denoting whether the insertion took place
+        std::pair<iterator, bool> insert(const value_type &value);
+        std::pair<iterator, bool> insert(value_type &&value);
+        // inserts value by key and returns iterator to where the element is in the container and bool denoting whether the insertion took place
+        std::pair<iterator, bool> insert(const Key &key, const T &obj);
+        // inserts an element or assigns to the current element if the key already exists
+        std::pair<iterator, bool> insert_or_assign(const Key &key, const T &obj);
+        // inserts an element built in place from args (a key and a value, or a pair of them)
+        template <class... Args>
+        std::pair<iterator, bool> emplace(Args &&...args);
+        // builds the value from args if there is no element with key, otherwise does nothing
+        template <class... Args>
+        std::pair<iterator, bool> try_emplace(const Key &key, Args &&...args);
+        template <class... Args>
+        std::pair<iterator, bool> try_emplace(Key &&key, Args &&...args);
+        // the returned iterators are taken after all the insertions, so every one of them is valid
+        template <class... Args>
+        std::vector<std::pair<iterator, bool>> insert_many(Args &&...args);
+        void merge(btree_map &other) { tree_type::merge(other); };
+
+        // erases every element the predicate holds for in one pass and returns how many were erased
+        template <typename K, typename V, typename C, typename Pred>
+        friend typename btree_map<K, V, C>::size_type erase_if(btree_map<K, V, C> &container, Pred pred);
+
+    private:
+        template <typename K, typename V>
+        std::pair<iterator, bool> EmplacePair(K &&key, V &&obj);
+        template <typename P>
+        std::pair<iterator, bool> EmplacePair(P &&pair);
+    };
+
+    template <typename Key, typename T, typename Compare>
+    btree_map<Key, T, Compare>::btree_map(const std::initializer_list<value_type> &items)
+            : btree_map(items.begin(), items.end()) {}
+
+    template <typename Key, typename T, typename Compare>
+    template <typename InputIt, typename>
+    btree_map<Key, T, Compare>::btree_map(InputIt first, InputIt last) {
+        for (; first != last; ++first) {
+            insert(*first);
+        }
+    }
+
+    template <typename Key, typename T, typename Compare>
+    btree_map<Key, T, Compare> &btree_map<Key, T, Compare>::operator=(btree_map &&other) noexcept {
+        if (this != &other) {
+            tree_type::operator=(std::move(other));
+        }
+        return *this;
+    }
+
+    template <typename Key, typename T, typename Compare>
+    btree_map<Key, T, Compare> &btree_map<Key, T, Compare>::operator=(const btree_map &other) {
+        if (this != &other) {
+            tree_type::operator=(other);
+        }
+        return *this;
+    }
+
+    template <typename Key, typename T, typename Compare>
+    T &btree_map<Key, T, Compare>::at(const Key &key) {
+        auto it = find(key);
+        if (it == this->end()) {
+            throw std::out_of_range("Container does not have an element with the specified key");
+        }
+        return it->second;
+    }
+
+    template <typename Key, typename T, typename Compare>
+    template <typename K, typename C, typename>
+    T &btree_map<Key, T, Compare>::at(const K &key) {
+        auto it = find(key);
+        if (it == this->end()) {
+            throw std::out_of_range("Container does not have an element with the specified key");
+        }
+        return it->second;
+    }
+
+    template <typename Key, typename T, typename Compare>
+    T &btree_map<Key, T, Compare>::operator[](const Key &key) {
+        return try_emplace(key).first->second;
+    }
+
+    template <typename Key, typename T, typename Compare>
+    std::pair<typename btree_map<Key, T, Compare>::iterator, bool> btree_map<Key, T, Compare>::insert(const value_type &value) {
+        return tree_type::EmplaceUnique(value.first, value);
+    }
+
+    template <typename Key, typename T, typename Compare>
+    std::pair<typename btree_map<Key, T, Compare>::iterator, bool> btree_map<Key, T, Compare>::insert(value_type &&value) {
+        return tree_type::EmplaceUnique(value.first, std::move(value));
+    }
+
+    template <typename Key, typename T, typename Compare>
+    std::pair<typename btree_map<Key, T, Compare>::iterator, bool> btree_map<Key, T, Compare>::insert(const Key &key,
+                                                                                                    const T &obj) {
+        return try_emplace(key, obj);
+    }
+
+    template <typename Key, typename T, typename Compare>
+    std::pair<typename btree_map<Key, T, Compare>::iterator, bool> btree_map<Key, T, Compare>::insert_or_assign(
+            const Key &key, const T &obj) {
+        auto result = try_emplace(key, obj);
+        if (!result.second) {
+            result.first->second = obj;
+        }
+        return result;
+    }
+
+    template <typename Key, typename T, typename Compare>
+    template <class... Args>
+    std::pair<typename btree_map<Key, T, Compare>::iterator, bool> btree_map<Key, T, Compare>::emplace(Args &&...args) {
+        return EmplacePair(std::forward<Args>(args)...);
+    }
+
+    template <typename Key, typename T, typename Compare>
+    template <class... Args>
+    std::pair<typename btree_map<Key, T, Compare>::iterator, bool> btree_map<Key, T, Compare>::try_emplace(const Key &key,
+                                                                                                         Args &&...args) {
+        return tree_type::EmplaceUnique(key, std::piecewise_construct, std::forward_as_tuple(key),
+                                        std::forward_as_tuple(std::forward<Args>(args)...));
+    }
+
+    template <typename Key, typename T, typename Compare>
+    template <class... Args>
+    std::pair<typename btree_map<Key, T, Compare>::iterator, bool> btree_map<Key, T, Compare>::try_emplace(Key &&key,
+                                                                                                         Args &&...args) {
+        return tree_type::EmplaceUnique(key, std::piecewise_construct, std::forward_as_tuple(std::move(key)),
+                                        std::forward_as_tuple(std::forward<Args>(args)...));
+    }
+
+    template <typename Key, typename T, typename Compare>
+    template <typename K, typename V>
+    std::pair<typename btree_map<Key, T, Compare>::iterator, bool> btree_map<Key, T, Compare>::EmplacePair(K &&key, V &&obj) {
+        if constexpr (std::is_same<typename std::decay<K>::type, Key>::value) {
+            return try_emplace(std::forward<K>(key), std::forward<V>(obj));
+        } else {
+            return try_emplace(Key(std::forward<K>(key)), std::forward<V>(obj));
+        }
+    }
+
+    template <typename Key, typename T, typename Compare>
+    template <typename P>
+    std::pair<typename btree_map<Key, T, Compare>::iterator, bool> btree_map<Key, T, Compare>::EmplacePair(P &&pair) {
+        return EmplacePair(std::forward<P>(pair).first, std::forward<P>(pair).second);
+    }
+
+    template <typename Key, typename T, typename Compare>
+    template <class... Args>
+    std::vector<std::pair<typename btree_map<Key, T, Compare>::iterator, bool>>
+    btree_map<Key, T, Compare>::insert_many(Args &&...args) {
+        std::vector<std::pair<iterator, bool>> vec;
+        vec.reserve(sizeof...(args));
+        std::vector<Key> keys;
+        keys.reserve(sizeof...(args));
+        ((vec.push_back(emplace(std::forward<Args>(args))), keys.push_back(vec.back().first->first)), ...);
+        // вставки могли сдвинуть значения в узлах - итераторы берутся заново
+        for (size_type i = 0; i < vec.size(); ++i) {
+            vec[i].first = find(keys[i]);
+        }
+        return vec;
+    }
+
+    template <typename Key, typename T, typename Compare, typename Pred>
+    typename btree_map<Key, T, Compare>::size_type erase_if(btree_map<Key, T, Compare> &container, Pred pred) {
+        return container.RemoveIf(pred);
+    }
+
+} // namespace s21
+
+#endif //SRC_S21_BTREE_MAP_H
@@ -0,0 +1,124 @@
+#ifndef SRC_S21_BTREE_SET_H
+#define SRC_S21_BTREE_SET_H
+
+#include <initializer_list>
+#include <iterator>
+#include <vector>
+
+#include "../BTree/BTree.h"
+
+// btree_set - тот же set, но на B-дереве: ключи лежат в узлах плотными массивами,
+// поэтому поиск по большому множеству делает в разы меньше промахов кэша.
+// Любое изменение дерева делает итераторы недействительными (значения переезжают внутри узлов).
+
+namespace s21 {
+    template <typename Key, typename Compare = std::less<Key>>
+    class btree_set : public BTree<Key, Key, IdentityKey<Key>, Compare> {
+        using tree_type = BTree<Key, Key, IdentityKey<Key>, Compare>;
+
+    public:
+        using key_type = Key;
+        using value_type = Key;
+        using reference = value_type &;
+        using const_reference = const value_type &;
+        using iterator = typename tree_type::Iterator;
+        using const_iterator = typename tree_type::ConstIterator;
+        using size_type = size_t;
+
+        btree_set() : tree_type(){};
+        btree_set(std::initializer_list<value_type> const &items);
+        template <typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category>
+        btree_set(InputIt first, InputIt last);
+        btree_set(const btree_set &other) : tree_type(other){};
+        btree_set(btree_set &&other) noexcept : tree_type(std::move(other)){};
+        btree_set &operator=(btree_set &&other) noexcept;
+        btree_set &operator=(const btree_set &other);
+        ~btree_set() = default;
+
+        iterator find(const key_type &key) { return tree_type::Find(key); };
+        template <typename K, typename C = Compare, typename = typename C::is_transparent>
+        iterator find(const K &key) { return tree_type::Find(key); };
+        // inserts value and returns iterator to where the element is in the container and bool denoting whether the insertion took place
+        std::pair<iterator, bool> insert(const value_type &value);
+        std::pair<iterator, bool> insert(value_type &&value);
+        // inserts an element built in place from args
+        template <class... Args>
+        std::pair<iterator, bool> emplace(Args &&...args);
+        // the returned iterators are taken after all the insertions, so every one of them is valid
+        template <class... Args>
+        std::vector<std::pair<iterator, bool>> insert_many(Args &&...args);
+        void merge(btree_set &other) { tree_type::merge(other); };
+
+        // erases every element the predicate holds for in one pass and returns how many were erased
+        template <typename K, typename C, typename Pred>
+        friend typename btree_set<K, C>::size_type erase_if(btree_set<K, C> &container, Pred pred);
+    };
+
+    template <typename Key, typename Compare>
+    btree_set<Key, Compare>::btree_set(const std::initializer_list<value_type> &items) : btree_set(items.begin(), items.end()) {}
+
+    template <typename Key, typename Compare>
+    template <typename InputIt, typename>
+    btree_set<Key, Compare>::btree_set(InputIt first, InputIt last) {
+        for (; first != last; ++first) {
+            insert(*first);
+        }
+    }
+
+    template <typename Key, typename Compare>
+    btree_set<Key, Compare> &btree_set<Key, Compare>::operator=(btree_set &&other) noexcept {
+        if (this != &other) {
+            tree_type::operator=(std::move(other));
+        }
+        return *this;
+    }
+
+    template <typename Key, typename Compare>
+    btree_set<Key, Compare> &btree_set<Key, Compare>::operator=(const btree_set &other) {
+        if (this != &other) {
+            tree_type::operator=(other);
+        }
+        return *this;
+    }
+
+    template <typename Key, typename Compare>
+    std::pair<typename btree_set<Key, Compare>::iterator, bool> btree_set<Key, Compare>::insert(const value_type &value) {
+        return tree_type::EmplaceUnique(value, value);
+    }
+
+    template <typename Key, typename Compare>
+    std::pair<typename btree_set<Key, Compare>::iterator, bool> btree_set<Key, Compare>::insert(value_type &&value) {
+        return tree_type::EmplaceUnique(value, std::move(value));
+    }
+
+    template <typename Key, typename Compare>
+    template <class... Args>
+    std::pair<typename btree_set<Key, Compare>::iterator, bool> btree_set<Key, Compare>::emplace(Args &&...args) {
+        value_type key(std::forward<Args>(args)...);
+        return insert(std::move(key));
+    }
+
+    template <typename Key, typename Compare>
+    template <class... Args>
+    std::vector<std::pair<typename btree_set<Key, Compare>::iterator, bool>> btree_set<Key, Compare>::insert_many(
+            Args &&...args) {
+        std::vector<std::pair<iterator, bool>> vec;
+        vec.reserve(sizeof...(args));
+        std::vector<value_type> keys;
+        keys.reserve(sizeof...(args));
+        ((vec.push_back(emplace(std::forward<Args>(args))), keys.push_back(*vec.back().first)), ...);
+        // вставки могли сдвинуть значения в узлах - итераторы берутся заново
+        for (size_type i = 0; i < vec.size(); ++i) {
+            vec[i].first = find(keys[i]);
+        }
+        return vec;
+    }
+
+    template <typename Key, typename Compare, typename Pred>
+    typename btree_set<Key, Compare>::size_type erase_if(btree_set<Key, Compare> &container, Pred pred) {
+        return container.RemoveIf(pred);
+    }
+
+} // namespace s21
+
+#endif //SRC_S21_BTREE_SET_H
@@ -0,0 +1,543 @@
+#ifndef SRC_S21_FLAT_MAP_H
+#define SRC_S21_FLAT_MAP_H
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <numeric>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "../../s21_containers/vector/s21_vector.h"
+
+// flat_map - тот же map, но ключи и значения лежат по порядку в двух s21::vector: keys_[i] соответствует values_[i].
+// Бинарный поиск ходит только по массиву ключей, поэтому в кэш не тянутся значения, которые поиску не нужны.
+// Вставка одного элемента сдвигает хвосты обоих массивов (O(n)) - заполнять контейнер лучше конструктором от
+// диапазона или insert_many: они сортируют новые элементы и сливают их с уже лежащими за один проход.
+// Пары std::pair<const Key, T> в памяти нет, поэтому итератор при разыменовании отдает пару ссылок.
+// Любая вставка или удаление делает итераторы недействительными.
+
+namespace s21 {
+    template <typename Key, typename T, typename Compare = std::less<Key>>
+    class flat_map {
+    public:
+        template <typename Mapped>
+        class FlatMapIterator;
+
+        using key_type = Key;
+        using mapped_type = T;
+        using value_type = std::pair<const key_type, mapped_type>;
+        using reference = std::pair<const key_type &, mapped_type &>; // ссылки на ключ и значение в своих массивах
+        using const_reference = std::pair<const key_type &, const mapped_type &>;
+        using iterator = FlatMapIterator<mapped_type>;
+        using const_iterator = FlatMapIterator<const mapped_type>;
+        using size_type = size_t;
+        using key_compare = Compare;
+
+        template <typename Mapped>
+        class FlatMapIterator {
+        public:
+            friend class flat_map<Key, T, Compare>;
+            using iterator_category = std::bidirectional_iterator_tag;
+            using difference_type = std::ptrdiff_t;
+            using value_type = std::pair<const Key, T>;
+            using reference = std::pair<const Key &, Mapped &>;
+
+            // it->first работает через временную пару ссылок
+            struct pointer {
+                reference ref_;
+                reference *operator->() { return &ref_; };
+            };
+
+            FlatMapIterator() = default;
+            FlatMapIterator(const Key *key, Mapped *value) : key_(key), value_(value) {};
+            // iterator converts to const_iterator
+            template <typename Other, typename = typename std::enable_if<std::is_same<const Other, Mapped>::value>::type>
+            FlatMapIterator(const FlatMapIterator<Other> &other) : key_(other.key_), value_(other.value_) {};
+
+            reference operator*() const { return reference(*key_, *value_); };
+            pointer operator->() const { return pointer{**this}; };
+            FlatMapIterator &operator++();
+            FlatMapIterator operator++(int);
+            FlatMapIterator &operator--();
+            FlatMapIterator operator--(int);
+            bool operator==(const FlatMapIterator &other) const { return key_ == other.key_; };
+            bool operator!=(const FlatMapIterator &other) const { return key_ != other.key_; };
+            difference_type operator-(const FlatMapIterator &other) const { return key_ - other.key_; };
+
+        private:
+            template <typename Other>
+            friend class FlatMapIterator;
+
+            const Key *key_ = nullptr;
+            Mapped *value_ = nullptr;
+        };
+
+        flat_map() = default;
+        flat_map(std::initializer_list<value_type> const &items);
+        // sorts the copied range once and keeps the first of equal keys
+        template <typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category>
+        flat_map(InputIt first, InputIt last);
+        flat_map(const flat_map &other);
+        flat_map(flat_map &&other) noexcept;
+        flat_map &operator=(const flat_map &other);
+        flat_map &operator=(flat_map &&other) noexcept;
+        ~flat_map() = default;
+
+        iterator begin() { return MakeIterator(0); };
+        iterator end() { return MakeIterator(size()); };
+        const_iterator cbegin() const { return const_iterator(keys_.data(), values_.data()); };
+        const_iterator cend() const { return const_iterator(keys_.data() + size(), values_.data() + size()); };
+
+        bool empty() const { return keys_.empty(); }; // checks whether the container is empty
+        size_type size() const { return keys_.size(); }; // returns the number of elements
+        size_type max_size() const { return keys_.max_size(); }; // returns the maximum possible number of elements
+        void reserve(size_type count); // allocates storage for count keys and count values
+        size_type capacity() const { return keys_.capacity(); };
+
+        T &at(const Key &key);
+        template <typename K, typename C = Compare, typename = typename C::is_transparent>
+        T &at(const K &key);
+        T &operator[](const Key &key);
+
+        void clear(); // clears the contents
+        // inserts node and returns iterator to where the element is in the container and bool denoting whether the insertion took place
+        std::pair<iterator, bool> insert(const value_type &value);
+        // inserts value by key and returns iterator to where the element is in the container and bool denoting whether the insertion took place
+        std::pair<iterator, bool> insert(const Key &key, const T &obj);
+        // inserts an element or assigns to the current element if the key already exists
+        std::pair<iterator, bool> insert_or_assign(const Key &key, const T &obj);
+        // inserts an element built from args (a key and a value, or a pair of them)
+        template <class... Args>
+        std::pair<iterator, bool> emplace(Args &&...args);
+        // builds the value from args if there is no element with key, otherwise does nothing
+        template <class... Args>
+        std::pair<iterator, bool> try_emplace(const Key &key, Args &&...args);
+        // sorts the new pairs and merges them with the stored ones in one pass; every returned iterator is valid
+        template <class... Args>
+        std::vector<std::pair<iterator, bool>> insert_many(Args &&...args);
+        iterator erase(iterator pos); // erases element at pos and returns the iterator to the next one
+        iterator erase(iterator first, iterator last); // erases [first, last) and returns the iterator after them
+        void swap(flat_map &other); // swaps the contents
+        void merge(flat_map &other); // moves the elements of other whose keys are not here yet, in one pass
+
+        iterator find(const Key &key) { return MakeIterator(FindIndex(key)); };
+        template <typename K, typename C = Compare, typename = typename C::is_transparent>
+        iterator find(const K &key) { return MakeIterator(FindIndex(key)); };
+        bool contains(const Key &key) const { return FindIndex(key) != size(); };
+        template <typename K, typename C = Compare, typename = typename C::is_transparent>
+        bool contains(const K &key) const { return FindIndex(key) != size(); };
+        size_type count(const Key &key) const { return contains(key) ? 1 : 0; }; // returns the number of elements with key (0 or 1)
+        key_compare key_comp() const { return comp_; }; // returns the function that compares keys
+        // returns iterator to the first element not less than key or end()
+        iterator lower_bound(const Key &key) { return MakeIterator(LowerBoundIndex(key)); };
+        template <typename K, typename C = Compare, typename = typename C::is_transparent>
+        iterator lower_bound(const K &key) { return MakeIterator(LowerBoundIndex(key)); };
+        // returns iterator to the first element greater than key or end()
+        iterator upper_bound(const Key &key) { return MakeIterator(UpperBoundIndex(key)); };
+        template <typename K, typename C = Compare, typename = typename C::is_transparent>
+        iterator upper_bound(const K &key) { return MakeIterator(UpperBoundIndex(key)); };
+        // returns the range of elements with key
+        std::pair<iterator, iterator> equal_range(const Key &key) { return EqualRange(key); };
+        template <typename K, typename C = Compare, typename = typename C::is_transparent>
+        std::pair<iterator, iterator> equal_range(const K &key) { return EqualRange(key); };
+
+        // erases every element the predicate holds for and returns how many were erased;
+        // the predicate gets a pair of references to the key and the value
+        template <typename K, typename V, typename C, typename Pred>
+        friend typename flat_map<K, V, C>::size_type erase_if(flat_map<K, V, C> &container, Pred pred);
+
+    private:
+        iterator MakeIterator(size_type pos) { return iterator(keys_.data() + pos, values_.data() + pos); };
+        template <typename K>
+        size_type LowerBoundIndex(const K &key) const;
+        template <typename K>
+        size_type UpperBoundIndex(const K &key) const;
+        template <typename K>
+        size_type FindIndex(const K &key) const; // index of the element with key or size()
+        template <typename K>
+        std::pair<iterator, iterator> EqualRange(const K &key);
+        iterator InsertAt(size_type pos, Key &&key, T &&obj); // puts the pair at pos shifting the tails by one
+        template <typename K, typename V>
+        std::pair<iterator, bool> EmplacePair(K &&key, V &&obj);
+        template <typename P>
+        std::pair<iterator, bool> EmplacePair(P &&pair);
+        // merges incoming_keys[i] -> incoming_values[i] into the stored elements (O(n + m log m)); returns for each of
+        // them the index of its key in the map and whether it was taken, the ones not taken are left untouched
+        std::vector<std::pair<size_type, bool>> BulkInsert(vector<Key> &incoming_keys, vector<T> &incoming_values);
+
+        vector<Key> keys_;
+        vector<T> values_;
+        Compare comp_;
+    };
+
+    template <typename Key, typename T, typename Compare>
+    template <typename Mapped>
+    typename flat_map<Key, T, Compare>::template FlatMapIterator<Mapped> &
+    flat_map<Key, T, Compare>::FlatMapIterator<Mapped>::operator++() {
+        ++key_;
+        ++value_;
+        return *this;
+    }
+
+    template <typename Key, typename T, typename Compare>
+    template <typename Mapped>
+    typename flat_map<Key, T, Compare>::template FlatMapIterator<Mapped>
+    flat_map<Key, T, Compare>::FlatMapIterator<Mapped>::operator++(int) {
+        FlatMapIterator tmp(*this);
+        ++(*this);
+        return tmp;
+    }
+
+    template <typename Key, typename T, typename Compare>
+    template <typename Mapped>
+    typename flat_map<Key, T, Compare>::template FlatMapIterator<Mapped> &
+    flat_map<Key, T, Compare>::FlatMapIterator<Mapped>::operator--() {
+        --key_;
+        --value_;
+        return *this;
+    }
+
+    template <typename Key, typename T, typename Compare>
+    template <typename Mapped>
+    typename flat_map<Key, T, Compare>::template FlatMapIterator<Mapped>
+    flat_map<Key, T, Compare>::FlatMapIterator<Mapped>::operator--(int) {
+        FlatMapIterator tmp(*this);
+        --(*this);
+        return tmp;
+    }
+
+    template <typename Key, typename T, typename Compare>
+    flat_map<Key, T, Compare>::flat_map(const std::initializer_list<value_type> &items) : flat_map(items.begin(), items.end()) {}
+
+    template <typename Key, typename T, typename Compare>
+    template <typename InputIt, typename>
+    flat_map<Key, T, Compare>::flat_map(InputIt first, InputIt last) {
+        vector<Key> incoming_keys;
+        vector<T> incoming_values;
+        for (; first != last; ++first) {
+            incoming_keys.push_back((*first).first);
+            incoming_values.push_back((*first).second);
+        }
+        BulkInsert(incoming_keys, incoming_values);
+    }
+
+    template <typename Key, typename T, typename Compare>
+    flat_map<Key, T, Compare>::flat_map(const flat_map &other)
+            : keys_(other.keys_), values_(other.values_), comp_(other.comp_) {}
+
+    template <typename Key, typename T, typename Compare>
+    flat_map<Key, T, Compare>::flat_map(flat_map &&other) noexcept
+            : keys_(std::move(other.keys_)), values_(std::move(other.values_)), comp_(std::move(other.comp_)) {}
+
+    template <typename Key, typename T, typename Compare>
+    flat_map<Key, T, Compare> &flat_map<Key, T, Compare>::operator=(const flat_map &other) {
+        if (this != &other) {
+            flat_map copy(other); // у s21::vector нет копирующего присваивания
+            swap(copy);
+        }
+        return *this;
+    }
+
+    template <typename Key, typename T, typename Compare>
+    flat_map<Key, T, Compare> &flat_map<Key, T, Compare>::operator=(flat_map &&other) noexcept {
+        if (this != &other) {
+            keys_ = std::move(other.keys_);
+            values_ = std::move(other.values_);
+            comp_ = std::move(other.comp_);
+        }
+        return *this;
+    }
+
+    template <typename Key, typename T, typename Compare>
+    void flat_map<Key, T, Compare>::reserve(size_type count) {
+        keys_.reserve(count);
+        values_.reserve(count);
+    }
+
+    template <typename Key, typename T, typename Compare>
+    T &flat_map<Key, T, Compare>::at(const Key &key) {
+        size_type pos = FindIndex(key);
+        if (pos == size()) {
+            throw std::out_of_range("Container does not have an element with the specified key");
+        }
+        return values_.data()[pos];
+    }
+
+    template <typename Key, typename T, typename Compare>
+    template <typename K, typename C, typename>
+    T &flat_map<Key, T, Compare>::at(const K &key) {
+        size_type pos = FindIndex(key);
+        if (pos == size()) {
+            throw std::out_of_range("Container does not have an element with the specified key");
+        }
+        return values_.data()[pos];
+    }
+
+    template <typename Key, typename T, typename Compare>
+    T &flat_map<Key, T, Compare>::operator[](const Key &key) {
+        return (*try_emplace(key).first).second;
+    }
+
+    template <typename Key, typename T, typename Compare>
+    void flat_map<Key, T, Compare>::clear() {
+        // vector::clear только обнуляет размер, поэтому ключи и значения сбрасываются явно
+        std::fill(keys_.data(), keys_.data() + size(), Key());
+        std::fill(values_.data(), values_.data() + size(), T());
+        keys_.clear();
+        values_.clear();
+    }
+
+    template <typename Key, typename T, typename Compare>
+    std::pair<typename flat_map<Key, T, Compare>::iterator, bool> flat_map<Key, T, Compare>::insert(const value_type &value) {
+        return try_emplace(value.first, value.second);
+    }
+
+    template <typename Key, typename T, typename Compare>
+    std::pair<typename flat_map<Key, T, Compare>::iterator, bool> flat_map<Key, T, Compare>::insert(const Key &key,
+                                                                                                  const T &obj) {
+        return try_emplace(key, obj);
+    }
+
+    template <typename Key, typename T, typename Compare>
+    std::pair<typename flat_map<Key, T, Compare>::iterator, bool> flat_map<Key, T, Compare>::insert_or_assign(
+            const Key &key, const T &obj) {
+        auto result = try_emplace(key, obj);
+        if (!result.second) {
+            (*result.first).second = obj;
+        }
+        return result;
+    }
+
+    template <typename Key, typename T, typename Compare>
+    template <class... Args>
+    std::pair<typename flat_map<Key, T, Compare>::iterator, bool> flat_map<Key, T, Compare>::emplace(Args &&...args) {
+        return EmplacePair(std::forward<Args>(args)...);
+    }
+
+    template <typename Key, typename T, typename Compare>
+    template <class... Args>
+    std::pair<typename flat_map<Key, T, Compare>::iterator, bool> flat_map<Key, T, Compare>::try_emplace(const Key &key,
+                                                                                                       Args &&...args) {
+        size_type pos = LowerBoundIndex(key);
+        if (pos < size() && !comp_(key, keys_.data()[pos])) {
+            return std::make_pair(MakeIterator(pos), false);
+        }
+        return std::make_pair(InsertAt(pos, Key(key), T(std::forward<Args>(args)...)), true);
+    }
+
+    template <typename Key, typename T, typename Compare>
+    template <class... Args>
+    std::vector<std::pair<typename flat_map<Key, T, Compare>::iterator, bool>> flat_map<Key, T, Compare>::insert_many(
+            Args &&...args) {
+        vector<Key> incoming_keys;
+        vector<T> incoming_values;
+        incoming_keys.reserve(sizeof...(args));
+        incoming_values.reserve(sizeof...(args));
+        ((incoming_keys.push_back(Key(std::forward<Args>(args).first)),
+          incoming_values.push_back(T(std::forward<Args>(args).second))), ...);
+        std::vector<std::pair<size_type, bool>> results = BulkInsert(incoming_keys, incoming_values);
+        std::vector<std::pair<iterator, bool>> vec;
+        vec.reserve(sizeof...(args));
+        for (const auto &result : results) {
+            vec.push_back(std::make_pair(MakeIterator(result.first), result.second));
+        }
+        return vec;
+    }
+
+    template <typename Key, typename T, typename Compare>
+    typename flat_map<Key, T, Compare>::iterator flat_map<Key, T, Compare>::erase(iterator pos) {
+        iterator next = pos;
+        return erase(pos, ++next);
+    }
+
+    template <typename Key, typename T, typename Compare>
+    typename flat_map<Key, T, Compare>::iterator flat_map<Key, T, Compare>::erase(iterator first, iterator last) {
+        Key *keys = keys_.data();
+        T *values = values_.data();
+        size_type from = static_cast<size_type>(first.key_ - keys);
+        size_type to = static_cast<size_type>(last.key_ - keys);
+        std::move(keys + to, keys + size(), keys + from);
+        std::move(values + to, values + size(), values + from);
+        // освободившийся хвост сбрасывается, чтобы удаленные ключи и значения не жили в буфере
+        std::fill(keys + size() - (to - from), keys + size(), Key());
+        std::fill(values + size() - (to - from), values + size(), T());
+        for (size_type i = from; i < to; ++i) {
+            keys_.pop_back();
+            values_.pop_back();
+        }
+        return MakeIterator(from);
+    }
+
+    template <typename Key, typename T, typename Compare>
+    void flat_map<Key, T, Compare>::swap(flat_map &other) {
+        keys_.swap(other.keys_);
+        values_.swap(other.values_);
+        std::swap(comp_, other.comp_);
+    }
+
+    template <typename Key, typename T, typename Compare>
+    void flat_map<Key, T, Compare>::merge(flat_map &other) {
+        if (this == &other) {
+            return;
+        }
+        vector<Key> incoming_keys;
+        vector<T> incoming_values;
+        incoming_keys.swap(other.keys_);
+        incoming_values.swap(other.values_);
+        std::vector<std::pair<size_type, bool>> results = BulkInsert(incoming_keys, incoming_values);
+        // в other остаются элементы, ключи которых здесь уже были, - по порядку, как и лежали
+        for (size_type i = 0; i < results.size(); ++i) {
+            if (!results[i].second) {
+                other.keys_.push_back(std::move(incoming_keys.data()[i]));
+                other.values_.push_back(std::move(incoming_values.data()[i]));
+            }
+        }
+    }
+
+    template <typename Key, typename T, typename Compare>
+    template <typename K>
+    typename flat_map<Key, T, Compare>::size_type flat_map<Key, T, Compare>::LowerBoundIndex(const K &key) const {
+        const Key *keys = keys_.data();
+        return static_cast<size_type>(
+                std::lower_bound(keys, keys + size(), key, [this](const Key &a, const K &b) { return comp_(a, b); }) - keys);
+    }
+
+    template <typename Key, typename T, typename Compare>
+    template <typename K>
+    typename flat_map<Key, T, Compare>::size_type flat_map<Key, T, Compare>::UpperBoundIndex(const K &key) const {
+        const Key *keys = keys_.data();
+        return static_cast<size_type>(
+                std::upper_bound(keys, keys + size(), key, [this](const K &a, const Key &b) { return comp_(a, b); }) - keys);
+    }
+
+    template <typename Key, typename T, typename Compare>
+    template <typename K>
+    typename flat_map<Key, T, Compare>::size_type flat_map<Key, T, Compare>::FindIndex(const K &key) const {
+        size_type pos = LowerBoundIndex(key);
+        if (pos < size() && !comp_(key, keys_.data()[pos])) {
+            return pos;
+        }
+        return size();
+    }
+
+    template <typename Key, typename T, typename Compare>
+    template <typename K>
+    std::pair<typename flat_map<Key, T, Compare>::iterator, typename flat_map<Key, T, Compare>::iterator>
+    flat_map<Key, T, Compare>::EqualRange(const K &key) {
+        size_type pos = LowerBoundIndex(key);
+        if (pos == size() || comp_(key, keys_.data()[pos])) {
+            return std::make_pair(MakeIterator(pos), MakeIterator(pos)); // ключа нет - диапазон пустой
+        }
+        return std::make_pair(MakeIterator(pos), MakeIterator(pos + 1));
+    }
+
+    template <typename Key, typename T, typename Compare>
+    typename flat_map<Key, T, Compare>::iterator flat_map<Key, T, Compare>::InsertAt(size_type pos, Key &&key, T &&obj) {
+        // s21::vector::insert копирует хвост - добавляем в конец и переносим на место перемещениями
+        keys_.push_back(std::move(key));
+        values_.push_back(std::move(obj));
+        Key *keys = keys_.data();
+        T *values = values_.data();
+        std::rotate(keys + pos, keys + size() - 1, keys + size());
+        std::rotate(values + pos, values + size() - 1, values + size());
+        return MakeIterator(pos);
+    }
+
+    template <typename Key, typename T, typename Compare>
+    template <typename K, typename V>
+    std::pair<typename flat_map<Key, T, Compare>::iterator, bool> flat_map<Key, T, Compare>::EmplacePair(K &&key, V &&obj) {
+        return try_emplace(Key(std::forward<K>(key)), std::forward<V>(obj));
+    }
+
+    template <typename Key, typename T, typename Compare>
+    template <typename P>
+    std::pair<typename flat_map<Key, T, Compare>::iterator, bool> flat_map<Key, T, Compare>::EmplacePair(P &&pair) {
+        return EmplacePair(std::forward<P>(pair).first, std::forward<P>(pair).second);
+    }
+
+    template <typename Key, typename T, typename Compare>
+    std::vector<std::pair<typename flat_map<Key, T, Compare>::size_type, bool>> flat_map<Key, T, Compare>::BulkInsert(
+            vector<Key> &incoming_keys, vector<T> &incoming_values) {
+        size_type count = incoming_keys.size();
+        Key *in_keys = incoming_keys.data();
+        T *in_values = incoming_values.data();
+        std::vector<size_type> order(count);
+        std::iota(order.begin(), order.end(), 0);
+        // сортируются только номера: ключи и значения переезжают один раз, уже при слиянии
+        auto by_key = [this, in_keys](size_type a, size_type b) { return comp_(in_keys[a], in_keys[b]); };
+        if (!std::is_sorted(order.begin(), order.end(), by_key)) {
+            std::stable_sort(order.begin(), order.end(), by_key); // из равных ключей первым остается тот, что шел раньше
+        }
+        // повторы внутри пачки отмечаются до того, как ключи начнут переезжать
+        std::vector<std::pair<size_type, bool>> results(count, std::make_pair(size_type(0), true));
+        for (size_type k = 1; k < count; ++k) {
+            if (!comp_(in_keys[order[k - 1]], in_keys[order[k]])) {
+                results[order[k]].second = false;
+            }
+        }
+
+        vector<Key> merged_keys;
+        vector<T> merged_values;
+        merged_keys.reserve(size() + count);
+        merged_values.reserve(size() + count);
+        size_type old = 0;
+        Key *old_keys = keys_.data();
+        T *old_values = values_.data();
+        auto take_old = [&] {
+            merged_keys.push_back(std::move(old_keys[old]));
+            merged_values.push_back(std::move(old_values[old]));
+            ++old;
+        };
+        for (size_type k = 0; k < count; ++k) {
+            size_type i = order[k];
+            if (!results[i].second) {
+                results[i].first = results[order[k - 1]].first; // повтор ключа из этой же пачки
+                continue;
+            }
+            while (old != size() && comp_(old_keys[old], in_keys[i])) {
+                take_old();
+            }
+            results[i].first = merged_keys.size();
+            if (old != size() && !comp_(in_keys[i], old_keys[old])) {
+                results[i].second = false; // такой ключ уже есть - он встанет ровно на это место
+                continue;
+            }
+            merged_keys.push_back(std::move(in_keys[i]));
+            merged_values.push_back(std::move(in_values[i]));
+        }
+        while (old != size()) {
+            take_old();
+        }
+        keys_ = std::move(merged_keys);
+        values_ = std::move(merged_values);
+        return results;
+    }
+
+    template <typename Key, typename T, typename Compare, typename Pred>
+    typename flat_map<Key, T, Compare>::size_type erase_if(flat_map<Key, T, Compare> &container, Pred pred) {
+        using size_type = typename flat_map<Key, T, Compare>::size_type;
+        Key *keys = container.keys_.data();
+        T *values = container.values_.data();
+        size_type kept = 0;
+        for (size_type i = 0; i < container.size(); ++i) {
+            if (!pred(std::pair<const Key &, T &>(keys[i], values[i]))) {
+                if (kept != i) {
+                    keys[kept] = std::move(keys[i]);
+                    values[kept] = std::move(values[i]);
+                }
+                ++kept;
+            }
+        }
+        size_type erased = container.size() - kept;
+        container.erase(container.MakeIterator(kept), container.end());
+        return erased;
+    }
+
+} // namespace s21
+
+#endif //SRC_S21_FLAT_MAP_H
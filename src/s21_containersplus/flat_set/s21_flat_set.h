@@ -0,0 +1,346 @@
+#ifndef SRC_S21_FLAT_SET_H
+#define SRC_S21_FLAT_SET_H
+
+#include <algorithm>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+#include "../../s21_containers/vector/s21_vector.h"
+
+// flat_set - тот же set, но ключи лежат по порядку в одном s21::vector, а поиск - бинарный.
+// Узлов нет: памяти на элемент уходит ровно sizeof(Key), а поиск и обход идут по соседним ячейкам.
+// Вставка одного ключа сдвигает хвост массива (O(n)), поэтому контейнер рассчитан на "построил один раз -
+// читаешь много": заполнять его лучше конструктором от диапазона или insert_many - они сортируют новые ключи
+// и сливают их с уже лежащими за один проход.
+// Любая вставка или удаление делает итераторы недействительными.
+
+namespace s21 {
+    template <typename Key, typename Compare = std::less<Key>>
+    class flat_set {
+    public:
+        using key_type = Key;
+        using value_type = Key;
+        using reference = value_type &;
+        using const_reference = const value_type &;
+        using iterator = const value_type *; // ключи менять нельзя - сломается порядок
+        using const_iterator = const value_type *;
+        using size_type = size_t;
+        using key_compare = Compare;
+
+        flat_set() = default;
+        flat_set(std::initializer_list<value_type> const &items);
+        // sorts the copied range once and keeps the first of equal keys
+        template <typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category>
+        flat_set(InputIt first, InputIt last);
+        flat_set(const flat_set &other);
+        flat_set(flat_set &&other) noexcept;
+        flat_set &operator=(const flat_set &other);
+        flat_set &operator=(flat_set &&other) noexcept;
+        ~flat_set() = default;
+
+        iterator begin() const { return keys_.data(); };
+        iterator end() const { return keys_.data() + keys_.size(); };
+        const_iterator cbegin() const { return begin(); };
+        const_iterator cend() const { return end(); };
+
+        bool empty() const { return keys_.empty(); }; // checks whether the container is empty
+        size_type size() const { return keys_.size(); }; // returns the number of elements
+        size_type max_size() const { return keys_.max_size(); }; // returns the maximum possible number of elements
+        void reserve(size_type count) { keys_.reserve(count); }; // allocates storage for count keys
+        size_type capacity() const { return keys_.capacity(); };
+
+        void clear(); // clears the contents and releases the keys
+        // inserts value and returns iterator to where the element is in the container and bool denoting whether the insertion took place
+        std::pair<iterator, bool> insert(const value_type &value);
+        std::pair<iterator, bool> insert(value_type &&value);
+        // inserts an element built in place from args
+        template <class... Args>
+        std::pair<iterator, bool> emplace(Args &&...args);
+        // sorts the new keys and merges them with the stored ones in one pass; every returned iterator is valid
+        template <class... Args>
+        std::vector<std::pair<iterator, bool>> insert_many(Args &&...args);
+        iterator erase(iterator pos); // erases element at pos and returns the iterator to the next one
+        iterator erase(iterator first, iterator last); // erases [first, last) and returns the iterator after them
+        void swap(flat_set &other); // swaps the contents
+        void merge(flat_set &other); // moves the keys of other that are not here yet, in one pass
+
+        iterator find(const Key &key) const { return Find(key); };
+        template <typename K, typename C = Compare, typename = typename C::is_transparent>
+        iterator find(const K &key) const { return Find(key); };
+        bool contains(const Key &key) const { return Find(key) != end(); };
+        template <typename K, typename C = Compare, typename = typename C::is_transparent>
+        bool contains(const K &key) const { return Find(key) != end(); };
+        size_type count(const Key &key) const { return contains(key) ? 1 : 0; }; // returns the number of elements with key (0 or 1)
+        key_compare key_comp() const { return comp_; }; // returns the function that compares keys
+        // returns iterator to the first element not less than key or end()
+        iterator lower_bound(const Key &key) const { return begin() + LowerBoundIndex(key); };
+        template <typename K, typename C = Compare, typename = typename C::is_transparent>
+        iterator lower_bound(const K &key) const { return begin() + LowerBoundIndex(key); };
+        // returns iterator to the first element greater than key or end()
+        iterator upper_bound(const Key &key) const { return begin() + UpperBoundIndex(key); };
+        template <typename K, typename C = Compare, typename = typename C::is_transparent>
+        iterator upper_bound(const K &key) const { return begin() + UpperBoundIndex(key); };
+        // returns the range of elements with key
+        std::pair<iterator, iterator> equal_range(const Key &key) const { return EqualRange(key); };
+        template <typename K, typename C = Compare, typename = typename C::is_transparent>
+        std::pair<iterator, iterator> equal_range(const K &key) const { return EqualRange(key); };
+
+        // erases every element the predicate holds for and returns how many were erased
+        template <typename K, typename C, typename Pred>
+        friend typename flat_set<K, C>::size_type erase_if(flat_set<K, C> &container, Pred pred);
+
+    private:
+        template <typename K>
+        size_type LowerBoundIndex(const K &key) const;
+        template <typename K>
+        size_type UpperBoundIndex(const K &key) const;
+        template <typename K>
+        iterator Find(const K &key) const;
+        template <typename K>
+        std::pair<iterator, iterator> EqualRange(const K &key) const;
+        iterator InsertAt(size_type pos, value_type &&value); // puts value at pos shifting the tail by one
+        // merges the keys of incoming into the stored ones (O(n + m log m)); returns for each of incoming the index of
+        // its key in the set and whether it was taken, the ones not taken are left untouched
+        std::vector<std::pair<size_type, bool>> BulkInsert(vector<value_type> &incoming);
+
+        vector<value_type> keys_;
+        Compare comp_;
+    };
+
+    template <typename Key, typename Compare>
+    flat_set<Key, Compare>::flat_set(const std::initializer_list<value_type> &items) : flat_set(items.begin(), items.end()) {}
+
+    template <typename Key, typename Compare>
+    template <typename InputIt, typename>
+    flat_set<Key, Compare>::flat_set(InputIt first, InputIt last) {
+        vector<value_type> incoming;
+        for (; first != last; ++first) {
+            incoming.push_back(*first);
+        }
+        BulkInsert(incoming);
+    }
+
+    template <typename Key, typename Compare>
+    flat_set<Key, Compare>::flat_set(const flat_set &other) : keys_(other.keys_), comp_(other.comp_) {}
+
+    template <typename Key, typename Compare>
+    flat_set<Key, Compare>::flat_set(flat_set &&other) noexcept
+            : keys_(std::move(other.keys_)), comp_(std::move(other.comp_)) {}
+
+    template <typename Key, typename Compare>
+    flat_set<Key, Compare> &flat_set<Key, Compare>::operator=(const flat_set &other) {
+        if (this != &other) {
+            vector<value_type> keys(other.keys_); // у s21::vector нет копирующего присваивания
+            keys_ = std::move(keys);
+            comp_ = other.comp_;
+        }
+        return *this;
+    }
+
+    template <typename Key, typename Compare>
+    flat_set<Key, Compare> &flat_set<Key, Compare>::operator=(flat_set &&other) noexcept {
+        if (this != &other) {
+            keys_ = std::move(other.keys_);
+            comp_ = std::move(other.comp_);
+        }
+        return *this;
+    }
+
+    template <typename Key, typename Compare>
+    std::pair<typename flat_set<Key, Compare>::iterator, bool> flat_set<Key, Compare>::insert(const value_type &value) {
+        size_type pos = LowerBoundIndex(value);
+        if (pos < size() && !comp_(value, keys_.data()[pos])) {
+            return std::make_pair(begin() + pos, false);
+        }
+        return std::make_pair(InsertAt(pos, value_type(value)), true);
+    }
+
+    template <typename Key, typename Compare>
+    std::pair<typename flat_set<Key, Compare>::iterator, bool> flat_set<Key, Compare>::insert(value_type &&value) {
+        size_type pos = LowerBoundIndex(value);
+        if (pos < size() && !comp_(value, keys_.data()[pos])) {
+            return std::make_pair(begin() + pos, false);
+        }
+        return std::make_pair(InsertAt(pos, std::move(value)), true);
+    }
+
+    template <typename Key, typename Compare>
+    template <class... Args>
+    std::pair<typename flat_set<Key, Compare>::iterator, bool> flat_set<Key, Compare>::emplace(Args &&...args) {
+        value_type key(std::forward<Args>(args)...);
+        return insert(std::move(key));
+    }
+
+    template <typename Key, typename Compare>
+    template <class... Args>
+    std::vector<std::pair<typename flat_set<Key, Compare>::iterator, bool>> flat_set<Key, Compare>::insert_many(
+            Args &&...args) {
+        vector<value_type> incoming;
+        incoming.reserve(sizeof...(args));
+        (incoming.push_back(value_type(std::forward<Args>(args))), ...);
+        std::vector<std::pair<size_type, bool>> results = BulkInsert(incoming);
+        std::vector<std::pair<iterator, bool>> vec;
+        vec.reserve(sizeof...(args));
+        for (const auto &result : results) {
+            vec.push_back(std::make_pair(begin() + result.first, result.second));
+        }
+        return vec;
+    }
+
+    template <typename Key, typename Compare>
+    void flat_set<Key, Compare>::clear() {
+        // vector::clear только обнуляет размер, поэтому ключи сбрасываются явно
+        std::fill(keys_.data(), keys_.data() + size(), Key());
+        keys_.clear();
+    }
+
+    template <typename Key, typename Compare>
+    typename flat_set<Key, Compare>::iterator flat_set<Key, Compare>::erase(iterator pos) {
+        return erase(pos, pos + 1);
+    }
+
+    template <typename Key, typename Compare>
+    typename flat_set<Key, Compare>::iterator flat_set<Key, Compare>::erase(iterator first, iterator last) {
+        value_type *data = keys_.data();
+        size_type from = static_cast<size_type>(first - data);
+        size_type to = static_cast<size_type>(last - data);
+        std::move(data + to, data + size(), data + from);
+        // освободившийся хвост сбрасывается, чтобы удаленные ключи не жили в буфере
+        std::fill(data + size() - (to - from), data + size(), Key());
+        for (size_type i = from; i < to; ++i) {
+            keys_.pop_back();
+        }
+        return begin() + from;
+    }
+
+    template <typename Key, typename Compare>
+    void flat_set<Key, Compare>::swap(flat_set &other) {
+        keys_.swap(other.keys_);
+        std::swap(comp_, other.comp_);
+    }
+
+    template <typename Key, typename Compare>
+    void flat_set<Key, Compare>::merge(flat_set &other) {
+        if (this == &other) {
+            return;
+        }
+        vector<value_type> incoming;
+        incoming.swap(other.keys_);
+        std::vector<std::pair<size_type, bool>> results = BulkInsert(incoming);
+        // в other остаются ключи, которые здесь уже были, - по порядку, как и лежали
+        for (size_type i = 0; i < results.size(); ++i) {
+            if (!results[i].second) {
+                other.keys_.push_back(std::move(incoming.data()[i]));
+            }
+        }
+    }
+
+    template <typename Key, typename Compare>
+    template <typename K>
+    typename flat_set<Key, Compare>::size_type flat_set<Key, Compare>::LowerBoundIndex(const K &key) const {
+        const value_type *data = keys_.data();
+        return static_cast<size_type>(
+                std::lower_bound(data, data + size(), key, [this](const value_type &a, const K &b) { return comp_(a, b); }) - data);
+    }
+
+    template <typename Key, typename Compare>
+    template <typename K>
+    typename flat_set<Key, Compare>::size_type flat_set<Key, Compare>::UpperBoundIndex(const K &key) const {
+        const value_type *data = keys_.data();
+        return static_cast<size_type>(
+                std::upper_bound(data, data + size(), key, [this](const K &a, const value_type &b) { return comp_(a, b); }) - data);
+    }
+
+    template <typename Key, typename Compare>
+    template <typename K>
+    typename flat_set<Key, Compare>::iterator flat_set<Key, Compare>::Find(const K &key) const {
+        size_type pos = LowerBoundIndex(key);
+        if (pos < size() && !comp_(key, keys_.data()[pos])) {
+            return begin() + pos;
+        }
+        return end();
+    }
+
+    template <typename Key, typename Compare>
+    template <typename K>
+    std::pair<typename flat_set<Key, Compare>::iterator, typename flat_set<Key, Compare>::iterator>
+    flat_set<Key, Compare>::EqualRange(const K &key) const {
+        iterator lower = Find(key);
+        if (lower == end()) {
+            lower = begin() + LowerBoundIndex(key);
+            return std::make_pair(lower, lower); // ключа нет - диапазон пустой
+        }
+        return std::make_pair(lower, lower + 1);
+    }
+
+    template <typename Key, typename Compare>
+    typename flat_set<Key, Compare>::iterator flat_set<Key, Compare>::InsertAt(size_type pos, value_type &&value) {
+        // s21::vector::insert копирует хвост - добавляем в конец и переносим на место перемещениями
+        keys_.push_back(std::move(value));
+        value_type *data = keys_.data();
+        std::rotate(data + pos, data + size() - 1, data + size());
+        return begin() + pos;
+    }
+
+    template <typename Key, typename Compare>
+    std::vector<std::pair<typename flat_set<Key, Compare>::size_type, bool>> flat_set<Key, Compare>::BulkInsert(
+            vector<value_type> &incoming) {
+        size_type count = incoming.size();
+        value_type *in = incoming.data();
+        std::vector<size_type> order(count);
+        std::iota(order.begin(), order.end(), 0);
+        auto by_key = [this, in](size_type a, size_type b) { return comp_(in[a], in[b]); };
+        if (!std::is_sorted(order.begin(), order.end(), by_key)) {
+            std::stable_sort(order.begin(), order.end(), by_key); // из равных ключей первым остается тот, что шел раньше
+        }
+        // повторы внутри пачки отмечаются до того, как ключи начнут переезжать
+        std::vector<std::pair<size_type, bool>> results(count, std::make_pair(size_type(0), true));
+        for (size_type k = 1; k < count; ++k) {
+            if (!comp_(in[order[k - 1]], in[order[k]])) {
+                results[order[k]].second = false;
+            }
+        }
+
+        vector<value_type> merged;
+        merged.reserve(size() + count);
+        value_type *old = keys_.data();
+        value_type *old_end = old + size();
+        for (size_type k = 0; k < count; ++k) {
+            size_type i = order[k];
+            if (!results[i].second) {
+                results[i].first = results[order[k - 1]].first; // повтор ключа из этой же пачки
+                continue;
+            }
+            while (old != old_end && comp_(*old, in[i])) {
+                merged.push_back(std::move(*old++));
+            }
+            results[i].first = merged.size();
+            if (old != old_end && !comp_(in[i], *old)) {
+                results[i].second = false; // такой ключ уже есть - он встанет ровно на это место
+                continue;
+            }
+            merged.push_back(std::move(in[i]));
+        }
+        while (old != old_end) {
+            merged.push_back(std::move(*old++));
+        }
+        keys_ = std::move(merged);
+        return results;
+    }
+
+    template <typename Key, typename Compare, typename Pred>
+    typename flat_set<Key, Compare>::size_type erase_if(flat_set<Key, Compare> &container, Pred pred) {
+        Key *data = container.keys_.data();
+        Key *last = std::remove_if(data, data + container.size(), pred);
+        typename flat_set<Key, Compare>::size_type erased = static_cast<size_t>(data + container.size() - last);
+        container.erase(last, container.end());
+        return erased;
+    }
+
+} // namespace s21
+
+#endif //SRC_S21_FLAT_SET_H
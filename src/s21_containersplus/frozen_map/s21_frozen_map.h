@@ -0,0 +1,159 @@
+#ifndef SRC_S21_FROZEN_MAP_H
+#define SRC_S21_FROZEN_MAP_H
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "../Eytzinger/Eytzinger.h"
+
+// frozen_map - неизменяемый снимок словаря (его делает map::freeze()). Ключи лежат в раскладке Эйтцингера,
+// как в frozen_set, значения - во втором массиве с той же раскладкой: поиск ходит только по ключам, а значение
+// найденного ключа лежит в той же ячейке второго массива. Итератор отдает пару ссылок, как у flat_map.
+
+namespace s21 {
+    template <typename Key, typename T, typename Compare = std::less<Key>>
+    class frozen_map {
+    public:
+        class FrozenMapIterator;
+
+        using key_type = Key;
+        using mapped_type = T;
+        using value_type = std::pair<const key_type, mapped_type>;
+        using const_reference = std::pair<const key_type &, const mapped_type &>;
+        using reference = const_reference;
+        using iterator = FrozenMapIterator;
+        using const_iterator = FrozenMapIterator;
+        using size_type = size_t;
+        using key_compare = Compare;
+
+        class FrozenMapIterator {
+        public:
+            friend class frozen_map<Key, T, Compare>;
+            using iterator_category = std::forward_iterator_tag;
+            using difference_type = std::ptrdiff_t;
+            using value_type = std::pair<const Key, T>;
+            using reference = std::pair<const Key &, const T &>;
+
+            // it->first работает через временную пару ссылок
+            struct pointer {
+                reference ref_;
+                reference *operator->() { return &ref_; };
+            };
+
+            FrozenMapIterator() = default;
+
+            reference operator*() const { return reference(keys_[cell_], values_[cell_]); };
+            pointer operator->() const { return pointer{**this}; };
+            FrozenMapIterator &operator++() {
+                cell_ = EytzingerArray<Key>::Next(cell_, size_);
+                return *this;
+            };
+            FrozenMapIterator operator++(int) {
+                FrozenMapIterator tmp(*this);
+                ++(*this);
+                return tmp;
+            };
+            bool operator==(const FrozenMapIterator &other) const { return cell_ == other.cell_; };
+            bool operator!=(const FrozenMapIterator &other) const { return cell_ != other.cell_; };
+
+        private:
+            FrozenMapIterator(const Key *keys, const T *values, size_t size, size_t cell)
+                    : keys_(keys), values_(values), size_(size), cell_(cell) {};
+
+            // массивы, а не frozen_map: при перемещении контейнера они остаются теми же, и итераторы не портятся
+            const Key *keys_ = nullptr;
+            const T *values_ = nullptr;
+            size_t size_ = 0;
+            size_t cell_ = 0; // 0 for end()
+        };
+
+        frozen_map() = default;
+        // sorts the copied pairs by key if they are not sorted yet and keeps the first of equal keys
+        template <typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category>
+        frozen_map(InputIt first, InputIt last, const Compare &comp = Compare());
+        frozen_map(const frozen_map &other) = default;
+        frozen_map(frozen_map &&other) noexcept = default;
+        frozen_map &operator=(const frozen_map &other) = default;
+        frozen_map &operator=(frozen_map &&other) noexcept = default;
+        ~frozen_map() = default;
+
+        const_iterator begin() const { return MakeIterator(EytzingerArray<Key>::First(size())); };
+        const_iterator end() const { return MakeIterator(0); };
+        const_iterator cbegin() const { return begin(); };
+        const_iterator cend() const { return end(); };
+
+        bool empty() const { return size() == 0; };
+        size_type size() const { return keys_.size(); };
+
+        const T &at(const Key &key) const;
+        const_iterator find(const Key &key) const { return MakeIterator(FindCell(key)); };
+        bool contains(const Key &key) const { return FindCell(key) != 0; };
+        size_type count(const Key &key) const { return contains(key) ? 1 : 0; };
+        key_compare key_comp() const { return comp_; };
+        // returns iterator to the first element not less than key or end()
+        const_iterator lower_bound(const Key &key) const { return MakeIterator(keys_.LowerBound(key, comp_)); };
+        // returns iterator to the first element greater than key or end()
+        const_iterator upper_bound(const Key &key) const { return MakeIterator(keys_.UpperBound(key, comp_)); };
+
+    private:
+        const_iterator MakeIterator(size_t cell) const {
+            return const_iterator(keys_.data(), values_.data(), size(), cell);
+        };
+        size_t FindCell(const Key &key) const;
+
+        EytzingerArray<Key> keys_;
+        EytzingerArray<T> values_; // values_[k] belongs to keys_[k]
+        Compare comp_;
+    };
+
+    template <typename Key, typename T, typename Compare>
+    template <typename InputIt, typename>
+    frozen_map<Key, T, Compare>::frozen_map(InputIt first, InputIt last, const Compare &comp) : comp_(comp) {
+        std::vector<std::pair<Key, T>> sorted;
+        for (; first != last; ++first) {
+            sorted.emplace_back((*first).first, (*first).second);
+        }
+        auto less = [this](const std::pair<Key, T> &a, const std::pair<Key, T> &b) { return comp_(a.first, b.first); };
+        if (!std::is_sorted(sorted.begin(), sorted.end(), less)) {
+            std::stable_sort(sorted.begin(), sorted.end(), less);
+        }
+        auto same = [&less](const std::pair<Key, T> &a, const std::pair<Key, T> &b) { return !less(a, b) && !less(b, a); };
+        sorted.erase(std::unique(sorted.begin(), sorted.end(), same), sorted.end());
+
+        std::vector<Key> keys;
+        std::vector<T> values;
+        keys.reserve(sorted.size());
+        values.reserve(sorted.size());
+        for (auto &pair : sorted) {
+            keys.push_back(std::move(pair.first));
+            values.push_back(std::move(pair.second));
+        }
+        keys_ = EytzingerArray<Key>(keys.begin(), keys.size());
+        values_ = EytzingerArray<T>(values.begin(), values.size());
+    }
+
+    template <typename Key, typename T, typename Compare>
+    const T &frozen_map<Key, T, Compare>::at(const Key &key) const {
+        size_t cell = FindCell(key);
+        if (cell == 0) {
+            throw std::out_of_range("Container does not have an element with the specified key");
+        }
+        return values_[cell];
+    }
+
+    template <typename Key, typename T, typename Compare>
+    size_t frozen_map<Key, T, Compare>::FindCell(const Key &key) const {
+        size_t cell = keys_.LowerBound(key, comp_);
+        if (cell == 0 || comp_(key, keys_[cell])) {
+            return 0;
+        }
+        return cell;
+    }
+} // namespace s21
+
+#endif //SRC_S21_FROZEN_MAP_H
@@ -0,0 +1,123 @@
+#ifndef SRC_S21_FROZEN_SET_H
+#define SRC_S21_FROZEN_SET_H
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <vector>
+
+#include "../Eytzinger/Eytzinger.h"
+
+// frozen_set - неизменяемый снимок множества (его делает set::freeze()). Ключи лежат одним выровненным массивом
+// в раскладке Эйтцингера (см. Eytzinger.h): поиск не ходит по указателям, не ветвится по результату сравнения
+// и заранее подгружает кэш-линии следующих уровней. Обход идет по возрастанию ключей, итераторы только читают.
+
+namespace s21 {
+    template <typename Key, typename Compare = std::less<Key>>
+    class frozen_set {
+    public:
+        class FrozenSetIterator;
+
+        using key_type = Key;
+        using value_type = Key;
+        using reference = const value_type &;
+        using const_reference = const value_type &;
+        using iterator = FrozenSetIterator;
+        using const_iterator = FrozenSetIterator;
+        using size_type = size_t;
+        using key_compare = Compare;
+
+        class FrozenSetIterator {
+        public:
+            friend class frozen_set<Key, Compare>;
+            using iterator_category = std::forward_iterator_tag;
+            using difference_type = std::ptrdiff_t;
+            using value_type = Key;
+            using pointer = const Key *;
+            using reference = const Key &;
+
+            FrozenSetIterator() = default;
+
+            reference operator*() const { return keys_[cell_]; };
+            pointer operator->() const { return keys_ + cell_; };
+            FrozenSetIterator &operator++() {
+                cell_ = EytzingerArray<Key>::Next(cell_, size_);
+                return *this;
+            };
+            FrozenSetIterator operator++(int) {
+                FrozenSetIterator tmp(*this);
+                ++(*this);
+                return tmp;
+            };
+            bool operator==(const FrozenSetIterator &other) const { return cell_ == other.cell_; };
+            bool operator!=(const FrozenSetIterator &other) const { return cell_ != other.cell_; };
+
+        private:
+            FrozenSetIterator(const Key *keys, size_t size, size_t cell) : keys_(keys), size_(size), cell_(cell) {};
+
+            // массив, а не frozen_set: при перемещении контейнера массив остается тем же, и итераторы не портятся
+            const Key *keys_ = nullptr;
+            size_t size_ = 0;
+            size_t cell_ = 0; // 0 for end()
+        };
+
+        frozen_set() = default;
+        // sorts the copied range if it is not sorted yet and keeps the first of equal keys
+        template <typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category>
+        frozen_set(InputIt first, InputIt last, const Compare &comp = Compare());
+        frozen_set(const frozen_set &other) = default;
+        frozen_set(frozen_set &&other) noexcept = default;
+        frozen_set &operator=(const frozen_set &other) = default;
+        frozen_set &operator=(frozen_set &&other) noexcept = default;
+        ~frozen_set() = default;
+
+        const_iterator begin() const { return MakeIterator(EytzingerArray<Key>::First(size())); };
+        const_iterator end() const { return MakeIterator(0); };
+        const_iterator cbegin() const { return begin(); };
+        const_iterator cend() const { return end(); };
+
+        bool empty() const { return size() == 0; };
+        size_type size() const { return keys_.size(); };
+
+        const_iterator find(const Key &key) const { return MakeIterator(FindCell(key)); };
+        bool contains(const Key &key) const { return FindCell(key) != 0; };
+        size_type count(const Key &key) const { return contains(key) ? 1 : 0; };
+        key_compare key_comp() const { return comp_; };
+        // returns iterator to the first element not less than key or end()
+        const_iterator lower_bound(const Key &key) const { return MakeIterator(keys_.LowerBound(key, comp_)); };
+        // returns iterator to the first element greater than key or end()
+        const_iterator upper_bound(const Key &key) const { return MakeIterator(keys_.UpperBound(key, comp_)); };
+
+    private:
+        const_iterator MakeIterator(size_t cell) const { return const_iterator(keys_.data(), size(), cell); };
+        size_t FindCell(const Key &key) const;
+
+        EytzingerArray<Key> keys_;
+        Compare comp_;
+    };
+
+    template <typename Key, typename Compare>
+    template <typename InputIt, typename>
+    frozen_set<Key, Compare>::frozen_set(InputIt first, InputIt last, const Compare &comp) : comp_(comp) {
+        std::vector<Key> sorted(first, last);
+        // снимок set уже отсортирован, тогда остается только проверка за O(n)
+        if (!std::is_sorted(sorted.begin(), sorted.end(), comp_)) {
+            std::stable_sort(sorted.begin(), sorted.end(), comp_);
+        }
+        auto same = [this](const Key &a, const Key &b) { return !comp_(a, b) && !comp_(b, a); };
+        sorted.erase(std::unique(sorted.begin(), sorted.end(), same), sorted.end());
+        keys_ = EytzingerArray<Key>(sorted.begin(), sorted.size());
+    }
+
+    template <typename Key, typename Compare>
+    size_t frozen_set<Key, Compare>::FindCell(const Key &key) const {
+        size_t cell = keys_.LowerBound(key, comp_);
+        if (cell == 0 || comp_(key, keys_[cell])) {
+            return 0;
+        }
+        return cell;
+    }
+} // namespace s21
+
+#endif //SRC_S21_FROZEN_SET_H
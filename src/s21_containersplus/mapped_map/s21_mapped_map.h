@@ -0,0 +1,168 @@
+#ifndef SRC_S21_MAPPED_MAP_H
+#define SRC_S21_MAPPED_MAP_H
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "../../s21_containers/map/s21_map.h"
+#include "../MappedImage/MappedImage.h"
+
+// mapped_map - словарь только для чтения поверх двоичного образа map (см. MappedImage.h), отображенного в память.
+// Открытие не читает данные: страницы файла подгружаются системой при первом обращении к ним, поэтому поиск
+// доступен сразу, а повторные запуски берут файл из page cache. Ключи и значения лежат в двух массивах, как
+// в flat_map: бинарный поиск ходит только по ключам, итератор отдает пару ссылок.
+// Образ пишет write_image; Compare должен задавать тот же порядок, что и у map, из которого он записан.
+
+namespace s21 {
+    template <typename Key, typename T, typename Compare = std::less<Key>>
+    class mapped_map {
+        static_assert(std::is_trivially_copyable<Key>::value && std::is_trivially_copyable<T>::value,
+                      "mapped_map needs trivially copyable keys and values");
+
+    public:
+        class MappedMapIterator;
+
+        using key_type = Key;
+        using mapped_type = T;
+        using value_type = std::pair<const key_type, mapped_type>;
+        using const_reference = std::pair<const key_type &, const mapped_type &>; // ссылки в отображенный файл
+        using reference = const_reference;
+        using iterator = MappedMapIterator;
+        using const_iterator = MappedMapIterator;
+        using size_type = size_t;
+        using key_compare = Compare;
+
+        class MappedMapIterator {
+        public:
+            using iterator_category = std::bidirectional_iterator_tag;
+            using difference_type = std::ptrdiff_t;
+            using value_type = std::pair<const Key, T>;
+            using reference = std::pair<const Key &, const T &>;
+
+            // it->first работает через временную пару ссылок
+            struct pointer {
+                reference ref_;
+                reference *operator->() { return &ref_; };
+            };
+
+            MappedMapIterator() = default;
+            MappedMapIterator(const Key *key, const T *value) : key_(key), value_(value) {};
+
+            reference operator*() const { return reference(*key_, *value_); };
+            pointer operator->() const { return pointer{**this}; };
+            MappedMapIterator &operator++() {
+                ++key_;
+                ++value_;
+                return *this;
+            };
+            MappedMapIterator operator++(int) {
+                MappedMapIterator tmp(*this);
+                ++(*this);
+                return tmp;
+            };
+            MappedMapIterator &operator--() {
+                --key_;
+                --value_;
+                return *this;
+            };
+            MappedMapIterator operator--(int) {
+                MappedMapIterator tmp(*this);
+                --(*this);
+                return tmp;
+            };
+            bool operator==(const MappedMapIterator &other) const { return key_ == other.key_; };
+            bool operator!=(const MappedMapIterator &other) const { return key_ != other.key_; };
+            difference_type operator-(const MappedMapIterator &other) const { return key_ - other.key_; };
+
+        private:
+            const Key *key_ = nullptr;
+            const T *value_ = nullptr;
+        };
+
+        mapped_map() = default;
+        // maps the image at path; throws std::runtime_error if it is missing, damaged or holds other types
+        explicit mapped_map(const std::string &path, const Compare &comp = Compare())
+                : image_(path, sizeof(Key), sizeof(T)), comp_(comp){};
+        mapped_map(mapped_map &&other) noexcept = default;
+        mapped_map &operator=(mapped_map &&other) noexcept = default;
+        ~mapped_map() = default;
+
+        const_iterator begin() const { return MakeIterator(0); };
+        const_iterator end() const { return MakeIterator(size()); };
+        const_iterator cbegin() const { return begin(); };
+        const_iterator cend() const { return end(); };
+
+        bool empty() const { return size() == 0; };
+        size_type size() const { return image_.Size(); };
+        // reads the whole image and checks it against the checksum written with it
+        bool verify() const { return image_.Verify(); };
+
+        const T &at(const Key &key) const;
+        const_iterator find(const Key &key) const { return MakeIterator(FindIndex(key)); };
+        bool contains(const Key &key) const { return FindIndex(key) != size(); };
+        size_type count(const Key &key) const { return contains(key) ? 1 : 0; };
+        key_compare key_comp() const { return comp_; };
+        // returns iterator to the first element not less than key or end()
+        const_iterator lower_bound(const Key &key) const { return MakeIterator(LowerBoundIndex(key)); };
+        // returns iterator to the first element greater than key or end()
+        const_iterator upper_bound(const Key &key) const;
+
+    private:
+        const Key *Keys() const { return static_cast<const Key *>(image_.Keys()); };
+        const T *Values() const { return static_cast<const T *>(image_.Values()); };
+        const_iterator MakeIterator(size_type pos) const { return const_iterator(Keys() + pos, Values() + pos); };
+        size_type LowerBoundIndex(const Key &key) const;
+        size_type FindIndex(const Key &key) const; // index of the element with key or size()
+
+        MappedImage image_;
+        Compare comp_;
+    };
+
+    // writes the image of container that mapped_map opens; throws std::runtime_error if the file can not be written
+    template <typename Key, typename T, typename Compare>
+    void write_image(const map<Key, T, Compare> &container, const std::string &path) {
+        WriteImage<Key, T>(path, container.cbegin(), container.cend(), container.size(),
+                           [](const std::pair<const Key, T> &value) -> const Key & { return value.first; },
+                           [](const std::pair<const Key, T> &value) -> const T & { return value.second; });
+    }
+
+    template <typename Key, typename T, typename Compare>
+    const T &mapped_map<Key, T, Compare>::at(const Key &key) const {
+        size_type pos = FindIndex(key);
+        if (pos == size()) {
+            throw std::out_of_range("Container does not have an element with the specified key");
+        }
+        return Values()[pos];
+    }
+
+    template <typename Key, typename T, typename Compare>
+    typename mapped_map<Key, T, Compare>::const_iterator mapped_map<Key, T, Compare>::upper_bound(const Key &key) const {
+        const Key *keys = Keys();
+        return MakeIterator(static_cast<size_type>(
+                std::upper_bound(keys, keys + size(), key, [this](const Key &a, const Key &b) { return comp_(a, b); }) - keys));
+    }
+
+    template <typename Key, typename T, typename Compare>
+    typename mapped_map<Key, T, Compare>::size_type mapped_map<Key, T, Compare>::LowerBoundIndex(const Key &key) const {
+        const Key *keys = Keys();
+        return static_cast<size_type>(
+                std::lower_bound(keys, keys + size(), key, [this](const Key &a, const Key &b) { return comp_(a, b); }) - keys);
+    }
+
+    template <typename Key, typename T, typename Compare>
+    typename mapped_map<Key, T, Compare>::size_type mapped_map<Key, T, Compare>::FindIndex(const Key &key) const {
+        size_type pos = LowerBoundIndex(key);
+        if (pos == size() || comp_(key, Keys()[pos])) {
+            return size();
+        }
+        return pos;
+    }
+} // namespace s21
+
+#endif //SRC_S21_MAPPED_MAP_H
@@ -0,0 +1,77 @@
+#ifndef SRC_S21_MAPPED_SET_H
+#define SRC_S21_MAPPED_SET_H
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <type_traits>
+
+#include "../../s21_containers/set/s21_set.h"
+#include "../MappedImage/MappedImage.h"
+
+// mapped_set - множество только для чтения поверх двоичного образа set, отображенного в память (см. mapped_map).
+// Ключи лежат в файле одним отсортированным массивом, итератор - указатель в него.
+
+namespace s21 {
+    template <typename Key, typename Compare = std::less<Key>>
+    class mapped_set {
+        static_assert(std::is_trivially_copyable<Key>::value, "mapped_set needs trivially copyable keys");
+
+    public:
+        using key_type = Key;
+        using value_type = Key;
+        using reference = const value_type &;
+        using const_reference = const value_type &;
+        using iterator = const value_type *;
+        using const_iterator = const value_type *;
+        using size_type = size_t;
+        using key_compare = Compare;
+
+        mapped_set() = default;
+        // maps the image at path; throws std::runtime_error if it is missing, damaged or holds other types
+        explicit mapped_set(const std::string &path, const Compare &comp = Compare())
+                : image_(path, sizeof(Key), 0), comp_(comp){};
+        mapped_set(mapped_set &&other) noexcept = default;
+        mapped_set &operator=(mapped_set &&other) noexcept = default;
+        ~mapped_set() = default;
+
+        const_iterator begin() const { return static_cast<const Key *>(image_.Keys()); };
+        const_iterator end() const { return begin() + size(); };
+        const_iterator cbegin() const { return begin(); };
+        const_iterator cend() const { return end(); };
+
+        bool empty() const { return size() == 0; };
+        size_type size() const { return image_.Size(); };
+        bool verify() const { return image_.Verify(); }; // reads the whole image and checks its checksum
+
+        const_iterator find(const Key &key) const;
+        bool contains(const Key &key) const { return find(key) != end(); };
+        size_type count(const Key &key) const { return contains(key) ? 1 : 0; };
+        key_compare key_comp() const { return comp_; };
+        const_iterator lower_bound(const Key &key) const { return std::lower_bound(begin(), end(), key, comp_); };
+        const_iterator upper_bound(const Key &key) const { return std::upper_bound(begin(), end(), key, comp_); };
+
+    private:
+        MappedImage image_;
+        Compare comp_;
+    };
+
+    // writes the image of container that mapped_set opens; throws std::runtime_error if the file can not be written
+    template <typename Key, typename Compare>
+    void write_image(const set<Key, Compare> &container, const std::string &path) {
+        WriteImage<Key, void>(path, container.cbegin(), container.cend(), container.size(),
+                              [](const Key &key) -> const Key & { return key; }, [](const Key &key) { return key; });
+    }
+
+    template <typename Key, typename Compare>
+    typename mapped_set<Key, Compare>::const_iterator mapped_set<Key, Compare>::find(const Key &key) const {
+        const_iterator it = lower_bound(key);
+        if (it == end() || comp_(key, *it)) {
+            return end();
+        }
+        return it;
+    }
+} // namespace s21
+
+#endif //SRC_S21_MAPPED_SET_H
@@ -0,0 +1,376 @@
+#ifndef SRC_S21_PERSISTENT_MAP_H
+#define SRC_S21_PERSISTENT_MAP_H
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+// persistent_map - неизменяемый словарь на AVL-дереве с общими узлами (structural sharing).
+// Узлы после создания не меняются, поэтому версии делят их: insert и erase копируют только путь от корня
+// до изменяемого узла (O(log n) узлов) и возвращают новую версию, старая остается как была.
+// Копия (снимок) версии - это копия указателя на корень, O(1). Счетчики ссылок на узлы атомарные (shared_ptr),
+// так что одну версию можно читать и копировать из нескольких потоков без блокировок; сам объект
+// persistent_map, в который записывают новую версию, нужно защищать как обычную переменную.
+
+namespace s21 {
+    template <typename Key, typename T, typename Compare = std::less<Key>>
+    class persistent_map {
+    protected:
+        struct Node;
+        using node_ptr = std::shared_ptr<const Node>;
+
+    public:
+        class ConstIterator;
+
+        using key_type = Key;
+        using mapped_type = T;
+        using value_type = std::pair<const key_type, mapped_type>;
+        using reference = value_type &;
+        using const_reference = const value_type &;
+        using iterator = ConstIterator; // элементы версии менять нельзя
+        using const_iterator = ConstIterator;
+        using size_type = size_t;
+        using key_compare = Compare;
+
+        persistent_map() : root_(nullptr), comp_(){};
+        persistent_map(std::initializer_list<value_type> const &items);
+        // builds the map in O(n) out of [first, last); of elements with equal keys the first one is kept
+        template <typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category>
+        persistent_map(InputIt first, InputIt last);
+        persistent_map(const persistent_map &other) = default; // O(1): the versions share all the nodes
+        persistent_map(persistent_map &&other) noexcept = default;
+        persistent_map &operator=(const persistent_map &other) = default;
+        persistent_map &operator=(persistent_map &&other) noexcept = default;
+        ~persistent_map() = default;
+
+        persistent_map snapshot() const { return *this; }; // returns this version in O(1)
+
+        const_iterator begin() const;
+        const_iterator end() const { return const_iterator(); };
+        const_iterator cbegin() const { return begin(); };
+        const_iterator cend() const { return end(); };
+
+        bool empty() const { return root_ == nullptr; };
+        size_type size() const { return GetSize(root_.get()); };
+        size_type max_size() const { return std::numeric_limits<size_type>::max() / sizeof(Node); };
+        key_compare key_comp() const { return comp_; };
+
+        const T &at(const Key &key) const; // throws std::out_of_range if there is no element with key
+        const_iterator find(const Key &key) const;
+        bool contains(const Key &key) const { return FindNode(key) != nullptr; };
+        size_type count(const Key &key) const { return contains(key) ? 1 : 0; };
+        const_iterator lower_bound(const Key &key) const; // first element not less than key or end()
+
+        // the modifying operations leave this version as it is and return the new one
+        [[nodiscard]] persistent_map insert(const value_type &value) const; // unchanged if key is already here
+        [[nodiscard]] persistent_map insert(const Key &key, const T &obj) const;
+        [[nodiscard]] persistent_map insert_or_assign(const Key &key, const T &obj) const;
+        [[nodiscard]] persistent_map erase(const Key &key) const; // unchanged if there is no element with key
+
+        // walks the version in order keeping the path from the root, so it needs no parent links in the nodes
+        class ConstIterator {
+        public:
+            friend class persistent_map;
+            using iterator_category = std::forward_iterator_tag;
+            using difference_type = std::ptrdiff_t;
+            using value_type = persistent_map::value_type;
+            using pointer = const value_type *;
+            using reference = const value_type &;
+
+            ConstIterator() = default;
+
+            reference operator*() const { return path_.back()->value_; };
+            pointer operator->() const { return &path_.back()->value_; };
+            ConstIterator &operator++();
+            ConstIterator operator++(int);
+            bool operator==(const ConstIterator &other) const;
+            bool operator!=(const ConstIterator &other) const { return !(*this == other); };
+
+        private:
+            // the current node on top and under it the ancestors whose left subtree the current node is in
+            std::vector<const Node *> path_;
+
+            void PushLeftPath(const Node *node);
+        };
+
+    protected:
+        struct Node {
+            template <typename... Args>
+            Node(node_ptr left, node_ptr right, Args &&...args);
+
+            const value_type value_;
+            const node_ptr left_;
+            const node_ptr right_;
+            const int height_; // height of the subtree rooted at this node (leaf = 1)
+            const size_type size_; // number of nodes in the subtree rooted at this node
+        };
+
+        node_ptr root_;
+        Compare comp_;
+
+        persistent_map(node_ptr root, const Compare &comp) : root_(std::move(root)), comp_(comp){};
+
+        static const Key &KeyOf(const Node *node) { return node->value_.first; };
+        static int GetHeight(const Node *node) { return node == nullptr ? 0 : node->height_; };
+        static size_type GetSize(const Node *node) { return node == nullptr ? 0 : node->size_; };
+        template <typename... Args>
+        static node_ptr MakeNode(node_ptr left, node_ptr right, Args &&...args);
+        // new node with value between left and right, whose heights differ by at most 2;
+        // restores the AVL invariant by building rotated copies of the nodes on the heavy side
+        static node_ptr Join(const node_ptr &left, const value_type &value, const node_ptr &right);
+        static node_ptr Build(const std::vector<const value_type *> &items, size_type first, size_type last);
+
+        const Node *FindNode(const Key &key) const;
+        // the copied path with value in place of the node with its key or in a new leaf
+        node_ptr Insert(const node_ptr &node, const value_type &value) const;
+        node_ptr Erase(const node_ptr &node, const Key &key) const; // key must be in the subtree
+        static node_ptr EraseMin(const node_ptr &node, const Node *&min); // the subtree without its leftmost node
+    };
+
+    template <typename Key, typename T, typename Compare>
+    template <typename... Args>
+    persistent_map<Key, T, Compare>::Node::Node(node_ptr left, node_ptr right, Args &&...args)
+            : value_(std::forward<Args>(args)...), left_(std::move(left)), right_(std::move(right)),
+              height_(std::max(GetHeight(left_.get()), GetHeight(right_.get())) + 1),
+              size_(GetSize(left_.get()) + GetSize(right_.get()) + 1) {}
+
+    template <typename Key, typename T, typename Compare>
+    persistent_map<Key, T, Compare>::persistent_map(const std::initializer_list<value_type> &items)
+            : persistent_map(items.begin(), items.end()) {}
+
+    template <typename Key, typename T, typename Compare>
+    template <typename InputIt, typename>
+    persistent_map<Key, T, Compare>::persistent_map(InputIt first, InputIt last) : persistent_map() {
+        std::vector<value_type> values(first, last);
+        std::vector<const value_type *> items;
+        items.reserve(values.size());
+        for (const value_type &value : values) {
+            items.push_back(&value);
+        }
+        // пары с const-ключом не переставить, поэтому сортируются указатели; stable_sort оставляет первый из равных
+        std::stable_sort(items.begin(), items.end(),
+                         [this](const value_type *lhs, const value_type *rhs) { return comp_(lhs->first, rhs->first); });
+        auto unique_end = std::unique(items.begin(), items.end(), [this](const value_type *lhs, const value_type *rhs) {
+            return !comp_(lhs->first, rhs->first);
+        });
+        items.erase(unique_end, items.end());
+        root_ = Build(items, 0, items.size());
+    }
+
+    template <typename Key, typename T, typename Compare>
+    typename persistent_map<Key, T, Compare>::const_iterator persistent_map<Key, T, Compare>::begin() const {
+        const_iterator it;
+        it.PushLeftPath(root_.get());
+        return it;
+    }
+
+    template <typename Key, typename T, typename Compare>
+    const T &persistent_map<Key, T, Compare>::at(const Key &key) const {
+        const Node *node = FindNode(key);
+        if (node == nullptr) {
+            throw std::out_of_range("Container does not have an element with the specified key");
+        }
+        return node->value_.second;
+    }
+
+    template <typename Key, typename T, typename Compare>
+    typename persistent_map<Key, T, Compare>::const_iterator persistent_map<Key, T, Compare>::find(const Key &key) const {
+        const_iterator it = lower_bound(key);
+        if (it != end() && comp_(key, it->first)) {
+            return end();
+        }
+        return it;
+    }
+
+    template <typename Key, typename T, typename Compare>
+    typename persistent_map<Key, T, Compare>::const_iterator persistent_map<Key, T, Compare>::lower_bound(
+            const Key &key) const {
+        const_iterator it;
+        const Node *node = root_.get();
+        while (node != nullptr) {
+            if (comp_(KeyOf(node), key)) {
+                node = node->right_.get();
+            } else {
+                // узел - кандидат, дальше ищем левее; он будет следующим после своего левого поддерева
+                it.path_.push_back(node);
+                node = node->left_.get();
+            }
+        }
+        return it;
+    }
+
+    template <typename Key, typename T, typename Compare>
+    persistent_map<Key, T, Compare> persistent_map<Key, T, Compare>::insert(const value_type &value) const {
+        if (contains(value.first)) {
+            return *this;
+        }
+        return persistent_map(Insert(root_, value), comp_);
+    }
+
+    template <typename Key, typename T, typename Compare>
+    persistent_map<Key, T, Compare> persistent_map<Key, T, Compare>::insert(const Key &key, const T &obj) const {
+        return insert(value_type(key, obj));
+    }
+
+    template <typename Key, typename T, typename Compare>
+    persistent_map<Key, T, Compare> persistent_map<Key, T, Compare>::insert_or_assign(const Key &key,
+                                                                                     const T &obj) const {
+        return persistent_map(Insert(root_, value_type(key, obj)), comp_);
+    }
+
+    template <typename Key, typename T, typename Compare>
+    persistent_map<Key, T, Compare> persistent_map<Key, T, Compare>::erase(const Key &key) const {
+        if (!contains(key)) {
+            return *this;
+        }
+        return persistent_map(Erase(root_, key), comp_);
+    }
+
+    template <typename Key, typename T, typename Compare>
+    template <typename... Args>
+    typename persistent_map<Key, T, Compare>::node_ptr persistent_map<Key, T, Compare>::MakeNode(node_ptr left,
+                                                                                               node_ptr right,
+                                                                                               Args &&...args) {
+        return std::make_shared<const Node>(std::move(left), std::move(right), std::forward<Args>(args)...);
+    }
+
+    template <typename Key, typename T, typename Compare>
+    typename persistent_map<Key, T, Compare>::node_ptr persistent_map<Key, T, Compare>::Join(const node_ptr &left,
+                                                                                           const value_type &value,
+                                                                                           const node_ptr &right) {
+        int left_height = GetHeight(left.get());
+        int right_height = GetHeight(right.get());
+        if (left_height > right_height + 1) {
+            if (GetHeight(left->left_.get()) >= GetHeight(left->right_.get())) {
+                // малый правый поворот
+                return MakeNode(left->left_, MakeNode(left->right_, right, value), left->value_);
+            }
+            // большой правый поворот: наверх поднимается правый сын левого поддерева
+            const Node *middle = left->right_.get();
+            return MakeNode(MakeNode(left->left_, middle->left_, left->value_), MakeNode(middle->right_, right, value),
+                            middle->value_);
+        }
+        if (right_height > left_height + 1) {
+            if (GetHeight(right->right_.get()) >= GetHeight(right->left_.get())) {
+                return MakeNode(MakeNode(left, right->left_, value), right->right_, right->value_);
+            }
+            const Node *middle = right->left_.get();
+            return MakeNode(MakeNode(left, middle->left_, value), MakeNode(middle->right_, right->right_, right->value_),
+                            middle->value_);
+        }
+        return MakeNode(left, right, value);
+    }
+
+    template <typename Key, typename T, typename Compare>
+    typename persistent_map<Key, T, Compare>::node_ptr persistent_map<Key, T, Compare>::Build(
+            const std::vector<const value_type *> &items, size_type first, size_type last) {
+        if (first == last) {
+            return nullptr;
+        }
+        size_type middle = first + (last - first) / 2;
+        return MakeNode(Build(items, first, middle), Build(items, middle + 1, last), *items[middle]);
+    }
+
+    template <typename Key, typename T, typename Compare>
+    const typename persistent_map<Key, T, Compare>::Node *persistent_map<Key, T, Compare>::FindNode(
+            const Key &key) const {
+        const Node *node = root_.get();
+        while (node != nullptr) {
+            if (comp_(key, KeyOf(node))) {
+                node = node->left_.get();
+            } else if (comp_(KeyOf(node), key)) {
+                node = node->right_.get();
+            } else {
+                return node;
+            }
+        }
+        return nullptr;
+    }
+
+    template <typename Key, typename T, typename Compare>
+    typename persistent_map<Key, T, Compare>::node_ptr persistent_map<Key, T, Compare>::Insert(
+            const node_ptr &node, const value_type &value) const {
+        if (node == nullptr) {
+            return MakeNode(nullptr, nullptr, value);
+        }
+        if (comp_(value.first, KeyOf(node.get()))) {
+            return Join(Insert(node->left_, value), node->value_, node->right_);
+        }
+        if (comp_(KeyOf(node.get()), value.first)) {
+            return Join(node->left_, node->value_, Insert(node->right_, value));
+        }
+        return MakeNode(node->left_, node->right_, value); // поддеревья узла остаются общими
+    }
+
+    template <typename Key, typename T, typename Compare>
+    typename persistent_map<Key, T, Compare>::node_ptr persistent_map<Key, T, Compare>::Erase(const node_ptr &node,
+                                                                                            const Key &key) const {
+        if (comp_(key, KeyOf(node.get()))) {
+            return Join(Erase(node->left_, key), node->value_, node->right_);
+        }
+        if (comp_(KeyOf(node.get()), key)) {
+            return Join(node->left_, node->value_, Erase(node->right_, key));
+        }
+        if (node->left_ == nullptr) {
+            return node->right_;
+        }
+        if (node->right_ == nullptr) {
+            return node->left_;
+        }
+        // на место узла встает копия его преемника; сам преемник жив, пока жива старая версия
+        const Node *successor = nullptr;
+        node_ptr right = EraseMin(node->right_, successor);
+        return Join(node->left_, successor->value_, right);
+    }
+
+    template <typename Key, typename T, typename Compare>
+    typename persistent_map<Key, T, Compare>::node_ptr persistent_map<Key, T, Compare>::EraseMin(const node_ptr &node,
+                                                                                               const Node *&min) {
+        if (node->left_ == nullptr) {
+            min = node.get();
+            return node->right_;
+        }
+        return Join(EraseMin(node->left_, min), node->value_, node->right_);
+    }
+
+    template <typename Key, typename T, typename Compare>
+    typename persistent_map<Key, T, Compare>::ConstIterator &persistent_map<Key, T, Compare>::ConstIterator::operator++() {
+        const Node *node = path_.back();
+        path_.pop_back();
+        PushLeftPath(node->right_.get());
+        return *this;
+    }
+
+    template <typename Key, typename T, typename Compare>
+    typename persistent_map<Key, T, Compare>::ConstIterator persistent_map<Key, T, Compare>::ConstIterator::operator++(
+            int) {
+        ConstIterator tmp = *this;
+        ++*this;
+        return tmp;
+    }
+
+    template <typename Key, typename T, typename Compare>
+    bool persistent_map<Key, T, Compare>::ConstIterator::operator==(const ConstIterator &other) const {
+        if (path_.empty() || other.path_.empty()) {
+            return path_.empty() && other.path_.empty();
+        }
+        return path_.back() == other.path_.back();
+    }
+
+    template <typename Key, typename T, typename Compare>
+    void persistent_map<Key, T, Compare>::ConstIterator::PushLeftPath(const Node *node) {
+        for (; node != nullptr; node = node->left_.get()) {
+            path_.push_back(node);
+        }
+    }
+
+} // namespace s21
+
+#endif //SRC_S21_PERSISTENT_MAP_H
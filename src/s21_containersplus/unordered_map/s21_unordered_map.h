@@ -0,0 +1,214 @@
+#ifndef SRC_S21_UNORDERED_MAP_H
+#define SRC_S21_UNORDERED_MAP_H
+
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include "../HashTable/HashTable.h"
+
+// unordered_map - словарь без порядка ключей: поиск, вставка и удаление в среднем за O(1).
+// Хранение - открытая адресация (см. HashTable.h), пары ключ-значение лежат прямо в массиве слотов.
+// Если Hash и KeyEqual прозрачные (есть is_transparent), find, at, contains, count и erase принимают
+// любой тип, который они умеют сравнивать, например std::string_view для ключей std::string.
+
+namespace s21 {
+    template <typename Key, typename T, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+    class unordered_map
+            : public HashTable<Key, std::pair<const Key, T>, PairFirstKey<std::pair<const Key, T>>, Hash, KeyEqual> {
+        using table_type = HashTable<Key, std::pair<const Key, T>, PairFirstKey<std::pair<const Key, T>>, Hash, KeyEqual>;
+
+    public:
+        using key_type = Key;
+        using mapped_type = T;
+        using value_type = std::pair<const key_type, mapped_type>;
+        using reference = value_type &;
+        using const_reference = const value_type &;
+        using iterator = typename table_type::Iterator;
+        using const_iterator = typename table_type::ConstIterator;
+        using size_type = size_t;
+
+        unordered_map() : table_type(){};
+        explicit unordered_map(size_type bucket_count, const Hash &hash = Hash(), const KeyEqual &equal = KeyEqual())
+                : table_type(bucket_count, hash, equal){};
+        unordered_map(std::initializer_list<value_type> const &items);
+        template <typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category>
+        unordered_map(InputIt first, InputIt last);
+        unordered_map(const unordered_map &other) : table_type(other){};
+        unordered_map(unordered_map &&other) noexcept : table_type(std::move(other)){};
+        unordered_map &operator=(unordered_map &&other) noexcept;
+        unordered_map &operator=(const unordered_map &other);
+        ~unordered_map() = default;
+
+        iterator find(const Key &key) { return table_type::Find(key); };
+        template <typename K, typename H = Hash, typename E = KeyEqual, typename = typename H::is_transparent,
+                  typename = typename E::is_transparent>
+        iterator find(const K &key) { return table_type::Find(key); };
+        T &at(const Key &key) { return At(key); };
+        template <typename K, typename H = Hash, typename E = KeyEqual, typename = typename H::is_transparent,
+                  typename = typename E::is_transparent>
+        T &at(const K &key) { return At(key); };
+        T &operator[](const Key &key);
+        // inserts node and returns iterator to where the element is in the container and bool denoting whether the insertion took place
+        std::pair<iterator, bool> insert(const value_type &value);
+        std::pair<iterator, bool> insert(value_type &&value);
+        // inserts value by key and returns iterator to where the element is in the container and bool denoting whether the insertion took place
+        std::pair<iterator, bool> insert(const Key &key, const T &obj);
+        // inserts an element or assigns to the current element if the key already exists
+        std::pair<iterator, bool> insert_or_assign(const Key &key, const T &obj);
+        // inserts an element built in place from args (a key and a value, or a pair of them)
+        template <class... Args>
+        std::pair<iterator, bool> emplace(Args &&...args);
+        // builds the value from args if there is no element with key, otherwise does nothing
+        template <class... Args>
+        std::pair<iterator, bool> try_emplace(const Key &key, Args &&...args);
+        template <class... Args>
+        std::pair<iterator, bool> try_emplace(Key &&key, Args &&...args);
+        // the returned iterators are taken after all the insertions, so every one of them is valid
+        template <class... Args>
+        std::vector<std::pair<iterator, bool>> insert_many(Args &&...args);
+        void merge(unordered_map &other) { table_type::merge(other); };
+
+    private:
+        template <typename K>
+        T &At(const K &key);
+        template <typename K, typename V>
+        std::pair<iterator, bool> EmplacePair(K &&key, V &&obj);
+        template <typename P>
+        std::pair<iterator, bool> EmplacePair(P &&pair);
+    };
+
+    template <typename Key, typename T, typename Hash, typename KeyEqual>
+    unordered_map<Key, T, Hash, KeyEqual>::unordered_map(const std::initializer_list<value_type> &items)
+            : unordered_map(items.begin(), items.end()) {}
+
+    template <typename Key, typename T, typename Hash, typename KeyEqual>
+    template <typename InputIt, typename>
+    unordered_map<Key, T, Hash, KeyEqual>::unordered_map(InputIt first, InputIt last) {
+        if constexpr (std::is_base_of<std::forward_iterator_tag,
+                                      typename std::iterator_traits<InputIt>::iterator_category>::value) {
+            this->reserve(static_cast<size_type>(std::distance(first, last)));
+        }
+        for (; first != last; ++first) {
+            insert(*first);
+        }
+    }
+
+    template <typename Key, typename T, typename Hash, typename KeyEqual>
+    unordered_map<Key, T, Hash, KeyEqual> &unordered_map<Key, T, Hash, KeyEqual>::operator=(unordered_map &&other) noexcept {
+        if (this != &other) {
+            table_type::operator=(std::move(other));
+        }
+        return *this;
+    }
+
+    template <typename Key, typename T, typename Hash, typename KeyEqual>
+    unordered_map<Key, T, Hash, KeyEqual> &unordered_map<Key, T, Hash, KeyEqual>::operator=(const unordered_map &other) {
+        if (this != &other) {
+            table_type::operator=(other);
+        }
+        return *this;
+    }
+
+    template <typename Key, typename T, typename Hash, typename KeyEqual>
+    T &unordered_map<Key, T, Hash, KeyEqual>::operator[](const Key &key) {
+        return try_emplace(key).first->second;
+    }
+
+    template <typename Key, typename T, typename Hash, typename KeyEqual>
+    std::pair<typename unordered_map<Key, T, Hash, KeyEqual>::iterator, bool> unordered_map<Key, T, Hash, KeyEqual>::insert(
+            const value_type &value) {
+        return table_type::EmplaceUnique(value.first, value);
+    }
+
+    template <typename Key, typename T, typename Hash, typename KeyEqual>
+    std::pair<typename unordered_map<Key, T, Hash, KeyEqual>::iterator, bool> unordered_map<Key, T, Hash, KeyEqual>::insert(
+            value_type &&value) {
+        return table_type::EmplaceUnique(value.first, std::move(value));
+    }
+
+    template <typename Key, typename T, typename Hash, typename KeyEqual>
+    std::pair<typename unordered_map<Key, T, Hash, KeyEqual>::iterator, bool> unordered_map<Key, T, Hash, KeyEqual>::insert(
+            const Key &key, const T &obj) {
+        return try_emplace(key, obj);
+    }
+
+    template <typename Key, typename T, typename Hash, typename KeyEqual>
+    std::pair<typename unordered_map<Key, T, Hash, KeyEqual>::iterator, bool>
+    unordered_map<Key, T, Hash, KeyEqual>::insert_or_assign(const Key &key, const T &obj) {
+        auto result = try_emplace(key, obj);
+        if (!result.second) {
+            result.first->second = obj;
+        }
+        return result;
+    }
+
+    template <typename Key, typename T, typename Hash, typename KeyEqual>
+    template <class... Args>
+    std::pair<typename unordered_map<Key, T, Hash, KeyEqual>::iterator, bool> unordered_map<Key, T, Hash, KeyEqual>::emplace(
+            Args &&...args) {
+        return EmplacePair(std::forward<Args>(args)...);
+    }
+
+    template <typename Key, typename T, typename Hash, typename KeyEqual>
+    template <class... Args>
+    std::pair<typename unordered_map<Key, T, Hash, KeyEqual>::iterator, bool>
+    unordered_map<Key, T, Hash, KeyEqual>::try_emplace(const Key &key, Args &&...args) {
+        return table_type::EmplaceUnique(key, std::piecewise_construct, std::forward_as_tuple(key),
+                                         std::forward_as_tuple(std::forward<Args>(args)...));
+    }
+
+    template <typename Key, typename T, typename Hash, typename KeyEqual>
+    template <class... Args>
+    std::pair<typename unordered_map<Key, T, Hash, KeyEqual>::iterator, bool>
+    unordered_map<Key, T, Hash, KeyEqual>::try_emplace(Key &&key, Args &&...args) {
+        return table_type::EmplaceUnique(key, std::piecewise_construct, std::forward_as_tuple(std::move(key)),
+                                         std::forward_as_tuple(std::forward<Args>(args)...));
+    }
+
+    template <typename Key, typename T, typename Hash, typename KeyEqual>
+    template <class... Args>
+    std::vector<std::pair<typename unordered_map<Key, T, Hash, KeyEqual>::iterator, bool>>
+    unordered_map<Key, T, Hash, KeyEqual>::insert_many(Args &&...args) {
+        // место под все пары берется заранее - вставки не перестраивают таблицу и итераторы остаются верными
+        this->reserve(this->size() + sizeof...(args));
+        std::vector<std::pair<iterator, bool>> vec;
+        vec.reserve(sizeof...(args));
+        (vec.push_back(emplace(std::forward<Args>(args))), ...);
+        return vec;
+    }
+
+    template <typename Key, typename T, typename Hash, typename KeyEqual>
+    template <typename K>
+    T &unordered_map<Key, T, Hash, KeyEqual>::At(const K &key) {
+        auto it = table_type::Find(key);
+        if (it == this->end()) {
+            throw std::out_of_range("Container does not have an element with the specified key");
+        }
+        return it->second;
+    }
+
+    template <typename Key, typename T, typename Hash, typename KeyEqual>
+    template <typename K, typename V>
+    std::pair<typename unordered_map<Key, T, Hash, KeyEqual>::iterator, bool>
+    unordered_map<Key, T, Hash, KeyEqual>::EmplacePair(K &&key, V &&obj) {
+        if constexpr (std::is_same<typename std::decay<K>::type, Key>::value) {
+            return try_emplace(std::forward<K>(key), std::forward<V>(obj));
+        } else {
+            return try_emplace(Key(std::forward<K>(key)), std::forward<V>(obj));
+        }
+    }
+
+    template <typename Key, typename T, typename Hash, typename KeyEqual>
+    template <typename P>
+    std::pair<typename unordered_map<Key, T, Hash, KeyEqual>::iterator, bool>
+    unordered_map<Key, T, Hash, KeyEqual>::EmplacePair(P &&pair) {
+        return EmplacePair(std::forward<P>(pair).first, std::forward<P>(pair).second);
+    }
+
+} // namespace s21
+
+#endif //SRC_S21_UNORDERED_MAP_H
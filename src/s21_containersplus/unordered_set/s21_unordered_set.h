@@ -0,0 +1,123 @@
+#ifndef SRC_S21_UNORDERED_SET_H
+#define SRC_S21_UNORDERED_SET_H
+
+#include <initializer_list>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+#include "../HashTable/HashTable.h"
+
+// unordered_set - множество уникальных ключей без порядка: поиск, вставка и удаление в среднем за O(1).
+// Хранение - открытая адресация (см. HashTable.h). Если Hash и KeyEqual прозрачные (есть is_transparent),
+// искать можно по любому типу, который они умеют сравнивать, например std::string_view для std::string.
+
+namespace s21 {
+    template <typename Key, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+    class unordered_set : public HashTable<Key, Key, IdentityKey<Key>, Hash, KeyEqual> {
+        using table_type = HashTable<Key, Key, IdentityKey<Key>, Hash, KeyEqual>;
+
+    public:
+        using key_type = Key;
+        using value_type = Key;
+        using reference = value_type &;
+        using const_reference = const value_type &;
+        using iterator = typename table_type::Iterator;
+        using const_iterator = typename table_type::ConstIterator;
+        using size_type = size_t;
+
+        unordered_set() : table_type(){};
+        explicit unordered_set(size_type bucket_count, const Hash &hash = Hash(), const KeyEqual &equal = KeyEqual())
+                : table_type(bucket_count, hash, equal){};
+        unordered_set(std::initializer_list<value_type> const &items);
+        template <typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category>
+        unordered_set(InputIt first, InputIt last);
+        unordered_set(const unordered_set &other) : table_type(other){};
+        unordered_set(unordered_set &&other) noexcept : table_type(std::move(other)){};
+        unordered_set &operator=(unordered_set &&other) noexcept;
+        unordered_set &operator=(const unordered_set &other);
+        ~unordered_set() = default;
+
+        iterator find(const key_type &key) { return table_type::Find(key); };
+        template <typename K, typename H = Hash, typename E = KeyEqual, typename = typename H::is_transparent,
+                  typename = typename E::is_transparent>
+        iterator find(const K &key) { return table_type::Find(key); };
+        // inserts value and returns iterator to where the element is in the container and bool denoting whether the insertion took place
+        std::pair<iterator, bool> insert(const value_type &value);
+        std::pair<iterator, bool> insert(value_type &&value);
+        // inserts an element built in place from args
+        template <class... Args>
+        std::pair<iterator, bool> emplace(Args &&...args);
+        // the returned iterators are taken after all the insertions, so every one of them is valid
+        template <class... Args>
+        std::vector<std::pair<iterator, bool>> insert_many(Args &&...args);
+        void merge(unordered_set &other) { table_type::merge(other); };
+    };
+
+    template <typename Key, typename Hash, typename KeyEqual>
+    unordered_set<Key, Hash, KeyEqual>::unordered_set(const std::initializer_list<value_type> &items)
+            : unordered_set(items.begin(), items.end()) {}
+
+    template <typename Key, typename Hash, typename KeyEqual>
+    template <typename InputIt, typename>
+    unordered_set<Key, Hash, KeyEqual>::unordered_set(InputIt first, InputIt last) {
+        if constexpr (std::is_base_of<std::forward_iterator_tag,
+                                      typename std::iterator_traits<InputIt>::iterator_category>::value) {
+            this->reserve(static_cast<size_type>(std::distance(first, last)));
+        }
+        for (; first != last; ++first) {
+            insert(*first);
+        }
+    }
+
+    template <typename Key, typename Hash, typename KeyEqual>
+    unordered_set<Key, Hash, KeyEqual> &unordered_set<Key, Hash, KeyEqual>::operator=(unordered_set &&other) noexcept {
+        if (this != &other) {
+            table_type::operator=(std::move(other));
+        }
+        return *this;
+    }
+
+    template <typename Key, typename Hash, typename KeyEqual>
+    unordered_set<Key, Hash, KeyEqual> &unordered_set<Key, Hash, KeyEqual>::operator=(const unordered_set &other) {
+        if (this != &other) {
+            table_type::operator=(other);
+        }
+        return *this;
+    }
+
+    template <typename Key, typename Hash, typename KeyEqual>
+    std::pair<typename unordered_set<Key, Hash, KeyEqual>::iterator, bool> unordered_set<Key, Hash, KeyEqual>::insert(
+            const value_type &value) {
+        return table_type::EmplaceUnique(value, value);
+    }
+
+    template <typename Key, typename Hash, typename KeyEqual>
+    std::pair<typename unordered_set<Key, Hash, KeyEqual>::iterator, bool> unordered_set<Key, Hash, KeyEqual>::insert(
+            value_type &&value) {
+        return table_type::EmplaceUnique(value, std::move(value));
+    }
+
+    template <typename Key, typename Hash, typename KeyEqual>
+    template <class... Args>
+    std::pair<typename unordered_set<Key, Hash, KeyEqual>::iterator, bool> unordered_set<Key, Hash, KeyEqual>::emplace(
+            Args &&...args) {
+        value_type key(std::forward<Args>(args)...);
+        return insert(std::move(key));
+    }
+
+    template <typename Key, typename Hash, typename KeyEqual>
+    template <class... Args>
+    std::vector<std::pair<typename unordered_set<Key, Hash, KeyEqual>::iterator, bool>>
+    unordered_set<Key, Hash, KeyEqual>::insert_many(Args &&...args) {
+        // место под все ключи берется заранее - вставки не перестраивают таблицу и итераторы остаются верными
+        this->reserve(this->size() + sizeof...(args));
+        std::vector<std::pair<iterator, bool>> vec;
+        vec.reserve(sizeof...(args));
+        (vec.push_back(emplace(std::forward<Args>(args))), ...);
+        return vec;
+    }
+
+} // namespace s21
+
+#endif //SRC_S21_UNORDERED_SET_H
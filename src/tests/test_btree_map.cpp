@@ -0,0 +1,85 @@
+#include <cstdlib>
+#include <map>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "test_entry.h"
+
+TEST(btree_map, InsertAndAccess) {
+    s21::btree_map<int, std::string> my_map{{1, "one"}, {2, "two"}};
+    EXPECT_EQ(my_map.at(1), "one");
+    EXPECT_THROW(my_map.at(3), std::out_of_range);
+    my_map[3] = "three";
+    EXPECT_EQ(my_map.size(), 3U);
+    EXPECT_FALSE(my_map.insert(1, "uno").second);
+    EXPECT_FALSE(my_map.insert_or_assign(1, "uno").second);
+    EXPECT_EQ(my_map.at(1), "uno");
+    EXPECT_TRUE(my_map.emplace(4, "four").second);
+    EXPECT_FALSE(my_map.try_emplace(4, "cuatro").second);
+    EXPECT_EQ(my_map.find(4)->second, "four");
+    auto results = my_map.insert_many(std::make_pair(5, "five"), std::make_pair(0, "zero"));
+    EXPECT_EQ(results[0].first->second, "five");
+    EXPECT_EQ(results[1].first->second, "zero");
+    EXPECT_EQ(my_map.begin()->first, 0);
+}
+
+TEST(btree_map, RandomOperationsMatchStdMap) {
+    s21::btree_map<int, int> my_map;
+    std::map<int, int> orig_map;
+    std::srand(16);
+    for (int i = 0; i < 30000; ++i) {
+        int key = std::rand() % 3000;
+        switch (std::rand() % 3) {
+            case 0:
+                my_map[key] += i;
+                orig_map[key] += i;
+                break;
+            case 1:
+                EXPECT_EQ(my_map.insert(key, i).second, orig_map.insert({key, i}).second);
+                break;
+            default:
+                my_map.erase(my_map.find(key));
+                orig_map.erase(key);
+        }
+    }
+    EXPECT_EQ(my_map.size(), orig_map.size());
+    auto orig_it = orig_map.begin();
+    for (auto it = my_map.begin(); it != my_map.end(); ++it, ++orig_it) {
+        ASSERT_EQ(it->first, orig_it->first);
+        ASSERT_EQ(it->second, orig_it->second);
+    }
+}
+
+TEST(btree_map, MergeKeepsExistingKeys) {
+    s21::btree_map<std::string, int, std::less<>> my_map{{"a", 1}, {"b", 2}};
+    s21::btree_map<std::string, int, std::less<>> other{{"b", 20}, {"c", 30}};
+    my_map.merge(other);
+    EXPECT_EQ(my_map.size(), 3U);
+    EXPECT_EQ(my_map.at(std::string_view("b")), 2);
+    EXPECT_EQ(my_map.at("c"), 30);
+    EXPECT_EQ(other.size(), 1U);
+    EXPECT_EQ(other.at("b"), 20);
+}
+
+TEST(btree_map, RangeEraseAndEraseIf) {
+    s21::btree_map<int, std::string> my_map;
+    for (int i = 0; i < 1000; ++i) {
+        my_map.insert(i, std::to_string(i));
+    }
+    auto next = my_map.erase(my_map.find(100), my_map.find(110));
+    EXPECT_EQ(next->first, 110);
+    next = my_map.erase(my_map.find(200), my_map.find(900));
+    EXPECT_EQ(next->second, "900");
+    EXPECT_EQ(my_map.size(), 290U);
+    EXPECT_FALSE(my_map.contains(105));
+    EXPECT_FALSE(my_map.contains(500));
+
+    EXPECT_EQ(s21::erase_if(my_map, [](const std::pair<const int, std::string> &entry) { return entry.first % 2 == 0; }),
+              145U);
+    EXPECT_EQ(my_map.size(), 145U);
+    for (auto entry : my_map) {
+        EXPECT_EQ(entry.first % 2, 1);
+        EXPECT_EQ(entry.second, std::to_string(entry.first));
+    }
+}
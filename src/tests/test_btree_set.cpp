@@ -0,0 +1,158 @@
+#include <algorithm>
+#include <cstdlib>
+#include <iterator>
+#include <set>
+#include <string>
+#include <string_view>
+
+#include "test_entry.h"
+
+namespace {
+    // Exposes the tree internals needed to check the B-tree invariant
+    template <typename Key>
+    class BTreeSetProbe : public s21::btree_set<Key> {
+        using Node = typename s21::btree_set<Key>::Node;
+
+    public:
+        // every leaf is on the same depth, every node but the root is at least half full,
+        // parent links and positions match and the keys are ordered
+        bool IsValid() {
+            if (this->root_ == nullptr) return this->size_ == 0;
+            int leaf_depth = -1;
+            size_t count = 0;
+            return CheckNode(this->root_, nullptr, 0, 0, leaf_depth, count) && count == this->size_ &&
+                   std::is_sorted(this->begin(), this->end());
+        }
+        int MaxValues() const { return this->kMaxValues; }
+
+    private:
+        bool CheckNode(Node *node, Node *parent, int position, int depth, int &leaf_depth, size_t &count) {
+            if (node->parent_ != parent || (parent != nullptr && node->position_ != position)) return false;
+            if (node != this->root_ && node->count_ < this->kMinValues) return false;
+            if (node->count_ > this->kMaxValues) return false;
+            count += node->count_;
+            if (node->leaf_) {
+                if (leaf_depth < 0) leaf_depth = depth;
+                return leaf_depth == depth;
+            }
+            for (int i = 0; i <= node->count_; ++i) {
+                if (!CheckNode(this->Child(node, i), node, i, depth + 1, leaf_depth, count)) return false;
+            }
+            return true;
+        }
+    };
+}  // namespace
+
+TEST(btree_set, InsertFindIterate) {
+    s21::btree_set<int> my_set{5, 1, 3, 3};
+    EXPECT_EQ(my_set.size(), 3U);
+    EXPECT_TRUE(my_set.contains(3));
+    EXPECT_FALSE(my_set.contains(4));
+    EXPECT_EQ(*my_set.find(5), 5);
+    EXPECT_TRUE(my_set.find(4) == my_set.end());
+    auto last = my_set.end();
+    --last;
+    EXPECT_EQ(*last, 5);
+    auto results = my_set.insert_many(7, 1, 2);
+    EXPECT_TRUE(results[0].second);
+    EXPECT_FALSE(results[1].second);
+    EXPECT_EQ(*results[0].first, 7);
+    EXPECT_EQ(*results[2].first, 2);
+    EXPECT_EQ(my_set.size(), 5U);
+}
+
+TEST(btree_set, RandomOperationsMatchStdSet) {
+    BTreeSetProbe<int> my_set;
+    std::set<int> orig_set;
+    std::srand(15);
+    for (int i = 0; i < 20000; ++i) {
+        int value = std::rand() % 5000;
+        if (std::rand() % 3 != 0) {
+            EXPECT_EQ(my_set.insert(value).second, orig_set.insert(value).second);
+        } else {
+            auto it = my_set.find(value);
+            EXPECT_EQ(it != my_set.end(), orig_set.erase(value) == 1);
+            my_set.erase(it);
+        }
+        if (i % 1000 == 0) {
+            ASSERT_TRUE(my_set.IsValid());
+        }
+    }
+    ASSERT_TRUE(my_set.IsValid());
+    EXPECT_EQ(my_set.size(), orig_set.size());
+    EXPECT_TRUE(std::equal(my_set.begin(), my_set.end(), orig_set.begin()));
+    EXPECT_TRUE(std::equal(std::make_reverse_iterator(my_set.end()), std::make_reverse_iterator(my_set.begin()),
+                           orig_set.rbegin()));
+    for (int key = -1; key < 5001; key += 7) {
+        auto lower = my_set.lower_bound(key);
+        auto orig_lower = orig_set.lower_bound(key);
+        ASSERT_EQ(lower == my_set.end(), orig_lower == orig_set.end());
+        if (orig_lower != orig_set.end()) {
+            ASSERT_EQ(*lower, *orig_lower);
+        }
+    }
+    while (!orig_set.empty()) {
+        my_set.erase(my_set.begin());
+        orig_set.erase(orig_set.begin());
+    }
+    EXPECT_TRUE(my_set.empty());
+    EXPECT_TRUE(my_set.begin() == my_set.end());
+}
+
+TEST(btree_set, CopyMoveAndMerge) {
+    s21::btree_set<std::string, std::less<>> my_set;
+    for (int i = 0; i < 1000; ++i) my_set.insert(std::to_string(i));
+    s21::btree_set<std::string, std::less<>> copy(my_set);
+    EXPECT_TRUE(std::equal(copy.begin(), copy.end(), my_set.begin()));
+    EXPECT_TRUE(copy.contains(std::string_view("999")));
+
+    s21::btree_set<std::string, std::less<>> other{"0", "new", "999", "zzz"};
+    my_set.merge(other);
+    EXPECT_EQ(my_set.size(), 1002U);
+    EXPECT_EQ(other.size(), 2U);
+    EXPECT_TRUE(other.contains("999"));
+
+    s21::btree_set<std::string, std::less<>> moved(std::move(copy));
+    EXPECT_EQ(moved.size(), 1000U);
+    EXPECT_TRUE(copy.empty());
+    copy = moved;
+    EXPECT_EQ(copy.size(), 1000U);
+}
+
+TEST(btree_set, RangeEraseAndEraseIfMatchStdSet) {
+    s21::btree_set<int> my_set;
+    std::set<int> orig_set;
+    for (int i = 0; i < 20000; ++i) {
+        my_set.insert(i * 3);
+        orig_set.insert(i * 3);
+    }
+    std::srand(15);
+    // короткие диапазоны удаляются по одному, длинные - одним проходом
+    for (int round = 0; round < 40; ++round) {
+        int from = std::rand() % 60000;
+        int length = round % 4 == 0 ? std::rand() % 20000 : std::rand() % 300;
+        auto result = my_set.erase(my_set.lower_bound(from), my_set.lower_bound(from + length));
+        auto orig_result = orig_set.erase(orig_set.lower_bound(from), orig_set.lower_bound(from + length));
+        ASSERT_EQ(result == my_set.end(), orig_result == orig_set.end());
+        if (orig_result != orig_set.end()) {
+            EXPECT_EQ(*result, *orig_result);
+        }
+        ASSERT_EQ(my_set.size(), orig_set.size());
+    }
+    EXPECT_TRUE(my_set.erase(my_set.begin(), my_set.begin()) == my_set.begin());
+    auto tail = my_set.lower_bound(50000);
+    EXPECT_TRUE(my_set.erase(tail, my_set.end()) == my_set.end());
+    orig_set.erase(orig_set.lower_bound(50000), orig_set.end());
+    EXPECT_TRUE(std::equal(my_set.begin(), my_set.end(), orig_set.begin(), orig_set.end()));
+
+    auto odd = [](int value) { return value % 2 != 0; };
+    size_t expected = static_cast<size_t>(std::count_if(orig_set.begin(), orig_set.end(), odd));
+    for (auto it = orig_set.begin(); it != orig_set.end();) {
+        it = odd(*it) ? orig_set.erase(it) : std::next(it);
+    }
+    EXPECT_EQ(s21::erase_if(my_set, odd), expected);
+    EXPECT_TRUE(std::equal(my_set.begin(), my_set.end(), orig_set.begin(), orig_set.end()));
+    EXPECT_EQ(s21::erase_if(my_set, [](int) { return true; }), orig_set.size());
+    EXPECT_TRUE(my_set.empty());
+    EXPECT_TRUE(my_set.begin() == my_set.end());
+}
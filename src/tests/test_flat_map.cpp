@@ -0,0 +1,126 @@
+#include <cstdlib>
+#include <map>
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include "test_entry.h"
+
+TEST(flat_map, InsertAndAccess) {
+    s21::flat_map<int, std::string> my_map{{2, "two"}, {1, "one"}, {2, "deux"}};
+    EXPECT_EQ(my_map.size(), 2U);
+    EXPECT_EQ(my_map.at(2), "two");
+    EXPECT_THROW(my_map.at(3), std::out_of_range);
+    my_map[3] = "three";
+    EXPECT_FALSE(my_map.insert(1, "uno").second);
+    EXPECT_FALSE(my_map.insert_or_assign(1, "uno").second);
+    EXPECT_EQ(my_map.at(1), "uno");
+    EXPECT_TRUE(my_map.emplace(4, "four").second);
+    EXPECT_FALSE(my_map.try_emplace(4, "cuatro").second);
+    EXPECT_EQ(my_map.find(4)->second, "four");
+    my_map.find(4)->second = "vier";
+    EXPECT_EQ(my_map.at(4), "vier");
+    EXPECT_EQ(my_map.begin()->first, 1);
+    EXPECT_EQ(my_map.lower_bound(0)->first, 1);
+    EXPECT_TRUE(my_map.upper_bound(4) == my_map.end());
+    s21::flat_map<int, std::string>::const_iterator it = my_map.begin();
+    EXPECT_EQ((*it).second, "uno");
+}
+
+TEST(flat_map, InsertManyMergesInOnePass) {
+    s21::flat_map<std::string, int, std::less<>> my_map{{"b", 2}, {"d", 4}};
+    my_map.reserve(8);
+    auto results = my_map.insert_many(std::make_pair("c", 3), std::make_pair("b", 20), std::make_pair("a", 1),
+                                      std::make_pair("c", 30));
+    ASSERT_EQ(results.size(), 4U);
+    EXPECT_TRUE(results[0].second);
+    EXPECT_FALSE(results[1].second);
+    EXPECT_TRUE(results[2].second);
+    EXPECT_FALSE(results[3].second);
+    EXPECT_EQ(results[0].first->second, 3);
+    EXPECT_EQ(results[1].first->second, 2);
+    EXPECT_EQ(results[2].first->second, 1);
+    EXPECT_EQ(results[3].first->second, 3);
+    EXPECT_EQ(my_map.size(), 4U);
+    EXPECT_EQ(my_map.at(std::string_view("c")), 3);
+}
+
+TEST(flat_map, RandomOperationsMatchStdMap) {
+    s21::flat_map<int, int> my_map;
+    std::map<int, int> orig_map;
+    std::srand(16);
+    for (int i = 0; i < 5000; ++i) {
+        int key = std::rand() % 1000;
+        switch (std::rand() % 4) {
+            case 0:
+                my_map[key] += i;
+                orig_map[key] += i;
+                break;
+            case 1:
+                EXPECT_EQ(my_map.insert(key, i).second, orig_map.insert({key, i}).second);
+                break;
+            case 2:
+                my_map.insert_many(std::make_pair(key, i), std::make_pair(key + 7, i));
+                orig_map.insert({key, i});
+                orig_map.insert({key + 7, i});
+                break;
+            default: {
+                auto it = my_map.find(key);
+                EXPECT_EQ(it != my_map.end(), orig_map.erase(key) == 1);
+                if (it != my_map.end()) my_map.erase(it);
+            }
+        }
+    }
+    ASSERT_EQ(my_map.size(), orig_map.size());
+    auto orig_it = orig_map.begin();
+    for (auto it = my_map.begin(); it != my_map.end(); ++it, ++orig_it) {
+        ASSERT_EQ(it->first, orig_it->first);
+        ASSERT_EQ(it->second, orig_it->second);
+    }
+    s21::erase_if(my_map, [](std::pair<const int &, int &> item) { return item.second % 2 == 0; });
+    for (auto it = my_map.begin(); it != my_map.end(); ++it) {
+        EXPECT_EQ(it->second % 2, 1);
+        EXPECT_EQ(orig_map.at(it->first), it->second);
+    }
+}
+
+TEST(flat_map, CopyMoveAndMerge) {
+    s21::flat_map<std::string, int> my_map{{"a", 1}, {"b", 2}};
+    s21::flat_map<std::string, int> other{{"b", 20}, {"c", 30}};
+    my_map.merge(other);
+    EXPECT_EQ(my_map.size(), 3U);
+    EXPECT_EQ(my_map.at("b"), 2);
+    EXPECT_EQ(my_map.at("c"), 30);
+    EXPECT_EQ(other.size(), 1U);
+    EXPECT_EQ(other.at("b"), 20);
+
+    s21::flat_map<std::string, int> copy(my_map);
+    s21::flat_map<std::string, int> moved(std::move(my_map));
+    EXPECT_TRUE(my_map.empty());
+    EXPECT_EQ(moved.at("c"), 30);
+    other = copy;
+    EXPECT_EQ(other.size(), 3U);
+    EXPECT_EQ(other.at("a"), 1);
+}
+
+TEST(flat_map, EraseAndClearReleaseValues) {
+    auto first = std::make_shared<int>(1);
+    auto second = std::make_shared<int>(2);
+    s21::flat_map<int, std::shared_ptr<int>> my_map;
+    my_map.insert(1, first);
+    my_map.insert(2, second);
+    my_map.insert(3, first);
+    EXPECT_EQ(first.use_count(), 3);
+    my_map.erase(my_map.find(1));
+    EXPECT_EQ(first.use_count(), 2);
+    EXPECT_EQ(second.use_count(), 2);
+    my_map.erase(my_map.begin(), my_map.end());
+    EXPECT_EQ(first.use_count(), 1);
+    EXPECT_EQ(second.use_count(), 1);
+
+    my_map.insert(1, first);
+    my_map.insert(2, second);
+    my_map.clear();
+    EXPECT_EQ(first.use_count(), 1);
+    EXPECT_EQ(second.use_count(), 1);
+}
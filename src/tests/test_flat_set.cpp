@@ -0,0 +1,113 @@
+#include <cstdlib>
+#include <memory>
+#include <set>
+#include <string>
+#include <string_view>
+
+#include "test_entry.h"
+
+TEST(flat_set, InsertFindIterate) {
+    s21::flat_set<int> my_set{5, 1, 3, 3};
+    EXPECT_EQ(my_set.size(), 3U);
+    EXPECT_TRUE(my_set.contains(3));
+    EXPECT_FALSE(my_set.contains(4));
+    EXPECT_EQ(*my_set.find(5), 5);
+    EXPECT_TRUE(my_set.find(4) == my_set.end());
+    EXPECT_TRUE(my_set.insert(4).second);
+    EXPECT_FALSE(my_set.insert(4).second);
+    int expected[] = {1, 3, 4, 5};
+    EXPECT_TRUE(std::equal(my_set.begin(), my_set.end(), std::begin(expected), std::end(expected)));
+    EXPECT_EQ(*my_set.lower_bound(2), 3);
+    EXPECT_EQ(*my_set.upper_bound(3), 4);
+    auto range = my_set.equal_range(2);
+    EXPECT_TRUE(range.first == range.second);
+    EXPECT_EQ(*my_set.erase(my_set.find(3)), 4);
+    EXPECT_EQ(my_set.size(), 3U);
+}
+
+TEST(flat_set, InsertManyMergesInOnePass) {
+    s21::flat_set<std::string, std::less<>> my_set{"b", "d"};
+    my_set.reserve(16);
+    EXPECT_GE(my_set.capacity(), 16U);
+    auto results = my_set.insert_many("e", "a", "d", "c", "a");
+    ASSERT_EQ(results.size(), 5U);
+    EXPECT_TRUE(results[0].second);
+    EXPECT_TRUE(results[1].second);
+    EXPECT_FALSE(results[2].second);
+    EXPECT_TRUE(results[3].second);
+    EXPECT_FALSE(results[4].second);
+    const char *expected[] = {"e", "a", "d", "c", "a"};
+    for (size_t i = 0; i < results.size(); ++i) {
+        EXPECT_EQ(*results[i].first, expected[i]);
+    }
+    EXPECT_EQ(my_set.size(), 5U);
+    EXPECT_TRUE(std::is_sorted(my_set.begin(), my_set.end()));
+    EXPECT_TRUE(my_set.contains(std::string_view("c")));
+}
+
+TEST(flat_set, RandomOperationsMatchStdSet) {
+    s21::flat_set<int> my_set;
+    std::set<int> orig_set;
+    std::srand(16);
+    for (int i = 0; i < 5000; ++i) {
+        int value = std::rand() % 1000;
+        switch (std::rand() % 3) {
+            case 0:
+                EXPECT_EQ(my_set.insert(value).second, orig_set.insert(value).second);
+                break;
+            case 1: {
+                auto results = my_set.insert_many(value, value + 1, value - 1);
+                EXPECT_EQ(results[0].second, orig_set.insert(value).second);
+                EXPECT_EQ(results[1].second, orig_set.insert(value + 1).second);
+                EXPECT_EQ(results[2].second, orig_set.insert(value - 1).second);
+                break;
+            }
+            default: {
+                auto it = my_set.find(value);
+                EXPECT_EQ(it != my_set.end(), orig_set.erase(value) == 1);
+                if (it != my_set.end()) my_set.erase(it);
+            }
+        }
+    }
+    EXPECT_EQ(my_set.size(), orig_set.size());
+    EXPECT_TRUE(std::equal(my_set.begin(), my_set.end(), orig_set.begin(), orig_set.end()));
+    EXPECT_EQ(s21::erase_if(my_set, [](int value) { return value % 2 == 0; }),
+              static_cast<size_t>(std::count_if(orig_set.begin(), orig_set.end(), [](int value) { return value % 2 == 0; })));
+    EXPECT_TRUE(std::all_of(my_set.begin(), my_set.end(), [](int value) { return value % 2 != 0; }));
+}
+
+TEST(flat_set, CopyMoveAndMerge) {
+    s21::flat_set<std::string> my_set{"a", "b"};
+    s21::flat_set<std::string> other{"b", "c"};
+    my_set.merge(other);
+    EXPECT_EQ(my_set.size(), 3U);
+    EXPECT_EQ(other.size(), 1U);
+    EXPECT_TRUE(other.contains("b"));
+
+    s21::flat_set<std::string> copy(my_set);
+    s21::flat_set<std::string> moved(std::move(my_set));
+    EXPECT_TRUE(my_set.empty());
+    EXPECT_TRUE(std::equal(copy.begin(), copy.end(), moved.begin(), moved.end()));
+    other = copy;
+    EXPECT_EQ(other.size(), 3U);
+    copy.clear();
+    EXPECT_EQ(other.size(), 3U);
+}
+
+TEST(flat_set, EraseAndClearReleaseKeys) {
+    auto first = std::make_shared<int>(1);
+    auto second = std::make_shared<int>(2);
+    s21::flat_set<std::shared_ptr<int>> my_set{first, second};
+    EXPECT_EQ(first.use_count(), 2);
+    my_set.erase(my_set.find(first));
+    EXPECT_EQ(first.use_count(), 1);
+    EXPECT_EQ(second.use_count(), 2);
+    my_set.erase(my_set.begin(), my_set.end());
+    EXPECT_EQ(second.use_count(), 1);
+
+    my_set.insert(first);
+    my_set.insert(second);
+    my_set.clear();
+    EXPECT_EQ(first.use_count(), 1);
+    EXPECT_EQ(second.use_count(), 1);
+}
@@ -0,0 +1,81 @@
+#include <cstdlib>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "test_entry.h"
+
+TEST(frozen_map, LookupsMatchStdMap) {
+    s21::map<int, std::string> source;
+    std::map<int, std::string> orig;
+    std::srand(25);
+    for (int i = 0; i < 3000; ++i) {
+        int key = std::rand() % 10000;
+        source.insert(key, std::to_string(key * 3));
+        orig.insert({key, std::to_string(key * 3)});
+    }
+    s21::frozen_map<int, std::string> frozen = source.freeze();
+    source.clear(); // снимок от исходного словаря не зависит
+    EXPECT_EQ(frozen.size(), orig.size());
+    for (int key = -1; key <= 10000; ++key) {
+        auto it = frozen.find(key);
+        auto orig_it = orig.find(key);
+        ASSERT_EQ(it == frozen.end(), orig_it == orig.end());
+        if (orig_it != orig.end()) {
+            EXPECT_EQ(it->second, orig_it->second);
+            EXPECT_EQ(frozen.at(key), orig_it->second);
+        } else {
+            EXPECT_THROW(frozen.at(key), std::out_of_range);
+        }
+        auto lower = frozen.lower_bound(key);
+        auto orig_lower = orig.lower_bound(key);
+        ASSERT_EQ(lower == frozen.end(), orig_lower == orig.end());
+        if (orig_lower != orig.end()) {
+            EXPECT_EQ(lower->first, orig_lower->first);
+        }
+    }
+
+    auto orig_it = orig.begin();
+    for (auto entry : frozen) {
+        EXPECT_EQ(entry.first, orig_it->first);
+        EXPECT_EQ(entry.second, orig_it->second);
+        ++orig_it;
+    }
+    EXPECT_TRUE(orig_it == orig.end());
+}
+
+TEST(frozen_map, BuildsFromPairs) {
+    std::vector<std::pair<std::string, int>> rows{{"b", 2}, {"a", 1}, {"c", 3}, {"a", 10}};
+    s21::frozen_map<std::string, int> frozen(rows.begin(), rows.end());
+    EXPECT_EQ(frozen.size(), 3U);
+    EXPECT_EQ(frozen.at("a"), 1); // из равных ключей остается первый
+    EXPECT_EQ(frozen.begin()->first, "a");
+    EXPECT_EQ(frozen.upper_bound("b")->second, 3);
+    EXPECT_FALSE(frozen.contains("d"));
+
+    s21::frozen_map<std::string, int> empty;
+    EXPECT_TRUE(empty.begin() == empty.end());
+    EXPECT_TRUE(empty.find("a") == empty.end());
+    empty = frozen;
+    EXPECT_EQ(empty.count("c"), 1U);
+}
+
+TEST(frozen_map, FreezesConstMapAndIteratorsSurviveMove) {
+    s21::map<int, std::string> source{{3, "c"}, {1, "a"}, {2, "b"}};
+    const s21::map<int, std::string> &loaded = source;
+    s21::frozen_map<int, std::string> frozen = loaded.freeze();
+    EXPECT_EQ(source.size(), 3U);
+
+    auto it = frozen.find(2);
+    auto first = frozen.begin();
+    s21::frozen_map<int, std::string> moved(std::move(frozen));
+    EXPECT_TRUE(first == moved.begin());
+    EXPECT_EQ(it->second, "b");
+    EXPECT_EQ((*++it).first, 3);
+    EXPECT_TRUE(++it == moved.end());
+
+    s21::frozen_map<int, std::string> assigned;
+    assigned = std::move(moved);
+    EXPECT_EQ(first->second, "a");
+}
@@ -0,0 +1,88 @@
+#include <array>
+#include <algorithm>
+#include <cstdlib>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "test_entry.h"
+
+TEST(frozen_set, BoundsMatchStdSetForEverySize) {
+    // все формы неполного последнего уровня дерева
+    for (int size = 0; size <= 70; ++size) {
+        s21::set<int> my_set;
+        std::set<int> orig_set;
+        for (int i = 0; i < size; ++i) {
+            my_set.insert(i * 2);
+            orig_set.insert(i * 2);
+        }
+        s21::frozen_set<int> frozen = my_set.freeze();
+        EXPECT_EQ(frozen.size(), orig_set.size());
+        EXPECT_TRUE(std::equal(frozen.begin(), frozen.end(), orig_set.begin(), orig_set.end()));
+        for (int key = -1; key <= size * 2; ++key) {
+            auto lower = frozen.lower_bound(key);
+            auto orig_lower = orig_set.lower_bound(key);
+            EXPECT_EQ(lower == frozen.end(), orig_lower == orig_set.end());
+            if (orig_lower != orig_set.end()) {
+                EXPECT_EQ(*lower, *orig_lower);
+            }
+            auto upper = frozen.upper_bound(key);
+            auto orig_upper = orig_set.upper_bound(key);
+            EXPECT_EQ(upper == frozen.end(), orig_upper == orig_set.end());
+            if (orig_upper != orig_set.end()) {
+                EXPECT_EQ(*upper, *orig_upper);
+            }
+            EXPECT_EQ(frozen.contains(key), orig_set.count(key) == 1);
+        }
+    }
+}
+
+TEST(frozen_set, BuildsFromUnsortedRangeAndCopies) {
+    std::vector<std::string> words{"pear", "apple", "fig", "apple", "kiwi", "fig"};
+    s21::frozen_set<std::string> frozen(words.begin(), words.end());
+    EXPECT_EQ(frozen.size(), 4U);
+    EXPECT_EQ(*frozen.begin(), "apple");
+    EXPECT_EQ(*frozen.find("kiwi"), "kiwi");
+    EXPECT_TRUE(frozen.find("plum") == frozen.end());
+    EXPECT_EQ(frozen.count("fig"), 1U);
+
+    s21::frozen_set<std::string> copy = frozen;
+    s21::frozen_set<std::string> moved(std::move(frozen));
+    EXPECT_TRUE(std::equal(copy.begin(), copy.end(), moved.begin(), moved.end()));
+    EXPECT_EQ(*std::next(moved.begin(), 3), "pear");
+
+    std::vector<int> numbers{1, 5, 3};
+    s21::frozen_set<int, std::greater<int>> descending(numbers.begin(), numbers.end());
+    EXPECT_EQ(*descending.begin(), 5);
+    EXPECT_EQ(*descending.lower_bound(4), 3);
+    EXPECT_TRUE(descending.upper_bound(1) == descending.end());
+}
+
+TEST(frozen_set, IteratorsSurviveMoveAndOddSizedKeys) {
+    s21::set<int> source{5, 1, 3};
+    const s21::set<int> &loaded = source;
+    s21::frozen_set<int> frozen = loaded.freeze();
+    EXPECT_EQ(source.size(), 3U);
+    EXPECT_EQ(std::vector<int>(loaded.cbegin(), loaded.cend()), std::vector<int>({1, 3, 5}));
+    auto it = frozen.find(3);
+    auto first = frozen.begin();
+    s21::frozen_set<int> moved(std::move(frozen));
+    EXPECT_TRUE(first == moved.begin());
+    EXPECT_EQ(*it, 3);
+    EXPECT_EQ(*++it, 5);
+    EXPECT_TRUE(++it == moved.end());
+    s21::frozen_set<int> assigned;
+    assigned = std::move(moved);
+    EXPECT_EQ(*first, 1);
+
+    // 12-байтные ключи не делят кэш-линии ровно, поиск для них обходится без подгрузки
+    std::vector<std::array<int, 3>> keys;
+    for (int i = 0; i < 1000; ++i) keys.push_back({i / 100, i % 100, -i});
+    s21::frozen_set<std::array<int, 3>> triples(keys.rbegin(), keys.rend());
+    EXPECT_EQ(triples.size(), keys.size());
+    EXPECT_TRUE(std::equal(triples.begin(), triples.end(), keys.begin(), keys.end()));
+    for (const auto &key : keys) {
+        EXPECT_TRUE(triples.contains(key));
+    }
+    EXPECT_FALSE(triples.contains({10, 0, 0}));
+}
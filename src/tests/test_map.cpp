@@ -1,4 +1,7 @@
 #include <map>
+#include <string>
+#include <string_view>
+#include <vector>
 
 #include "test_entry.h"
 
@@ -240,4 +243,400 @@ TEST(map, ContainsMap) {
 
     EXPECT_TRUE(my_map2.contains("bob"));
     EXPECT_FALSE(my_map2.contains("john"));
-}
\ No newline at end of file
+}
+TEST(map, SizeTracksModifications) {
+    s21::map<int, int> my_map;
+    for (int i = 0; i < 100; ++i) my_map.insert(i, i);
+    my_map.insert(5, 5);
+    EXPECT_EQ(my_map.size(), 100U);
+    my_map.erase(my_map.begin());
+    EXPECT_EQ(my_map.size(), 99U);
+    my_map[1000] = 1;
+    my_map.insert_or_assign(1000, 2);
+    EXPECT_EQ(my_map.size(), 100U);
+
+    s21::map<int, int> my_copy(my_map);
+    EXPECT_EQ(my_copy.size(), 100U);
+    s21::map<int, int> my_moved(std::move(my_copy));
+    EXPECT_EQ(my_moved.size(), 100U);
+    EXPECT_EQ(my_copy.size(), 0U);
+    EXPECT_TRUE(my_copy.empty());
+
+    s21::map<int, int> my_merge = {{-1, 0}, {-2, 0}, {1000, 0}};
+    my_map.merge(my_merge);
+    EXPECT_EQ(my_map.size(), 102U);
+    EXPECT_EQ(my_merge.size(), 1U);
+
+    my_map.swap(my_merge);
+    EXPECT_EQ(my_map.size(), 1U);
+    EXPECT_EQ(my_merge.size(), 102U);
+
+    my_merge = my_map;
+    EXPECT_EQ(my_merge.size(), 1U);
+    my_merge.clear();
+    EXPECT_EQ(my_merge.size(), 0U);
+    EXPECT_TRUE(my_merge.empty());
+}
+
+TEST(map, OrderStatistics) {
+    s21::map<int, char> my_map = {{10, 'a'}, {30, 'c'}, {20, 'b'}, {40, 'd'}};
+    EXPECT_EQ((*my_map.find_by_order(0)).first, 10);
+    EXPECT_EQ((*my_map.find_by_order(2)).second, 'c');
+    EXPECT_TRUE(my_map.find_by_order(4) == my_map.end());
+    EXPECT_EQ(my_map.order_of_key(10), 0U);
+    EXPECT_EQ(my_map.order_of_key(25), 2U);
+    EXPECT_EQ(my_map.order_of_key(50), 4U);
+    my_map.erase(my_map.find_by_order(1));
+    EXPECT_EQ((*my_map.find_by_order(1)).first, 30);
+    EXPECT_EQ(my_map.order_of_key(40), 2U);
+}
+
+TEST(map, NodeReuseAfterEraseAndClear) {
+    s21::map<int, std::string> my_map;
+    std::map<int, std::string> orig_map;
+    for (int round = 0; round < 3; ++round) {
+        for (int i = 0; i < 300; ++i) {
+            my_map.insert(i, std::to_string(i * round));
+            orig_map.insert({i, std::to_string(i * round)});
+        }
+        for (int i = 0; i < 300; i += 2) {
+            my_map.erase(my_map.find_by_order(static_cast<size_t>(i / 2)));
+            orig_map.erase(std::next(orig_map.begin(), i / 2));
+        }
+        for (int i = 1000; i < 1100; ++i) {
+            my_map[i] = "reused";
+            orig_map[i] = "reused";
+        }
+        ASSERT_EQ(my_map.size(), orig_map.size());
+        auto my_it = my_map.begin();
+        for (auto orig_it = orig_map.begin(); orig_it != orig_map.end(); ++orig_it, ++my_it) {
+            EXPECT_EQ((*my_it).first, orig_it->first);
+            EXPECT_EQ((*my_it).second, orig_it->second);
+        }
+        my_map.clear();
+        orig_map.clear();
+        EXPECT_TRUE(my_map.empty());
+    }
+}
+
+TEST(map, InsertReturnsPosition) {
+    s21::map<int, std::string> my_map = {{1, "one"}, {3, "three"}};
+    auto pr = my_map.insert(2, "two");
+    EXPECT_TRUE(pr.second);
+    EXPECT_EQ((*pr.first).first, 2);
+    ++pr.first;
+    EXPECT_EQ((*pr.first).first, 3);
+    pr = my_map.insert(3, "other");
+    EXPECT_FALSE(pr.second);
+    EXPECT_EQ((*pr.first).second, "three");
+    pr = my_map.insert_or_assign(3, "drei");
+    EXPECT_FALSE(pr.second);
+    EXPECT_EQ((*pr.first).second, "drei");
+    EXPECT_EQ(my_map.size(), 3U);
+    my_map[4] += "four";
+    my_map[4] += "!";
+    EXPECT_EQ(my_map.at(4), "four!");
+    EXPECT_EQ(my_map.size(), 4U);
+}
+
+TEST(map, CustomCompare) {
+    s21::map<int, char, std::greater<int>> my_map = {{1, 'a'}, {3, 'c'}, {2, 'b'}};
+    std::map<int, char, std::greater<int>> orig_map = {{1, 'a'}, {3, 'c'}, {2, 'b'}};
+    auto my_it = my_map.begin();
+    for (auto orig_it = orig_map.begin(); orig_it != orig_map.end(); ++orig_it, ++my_it) {
+        EXPECT_EQ((*my_it).first, orig_it->first);
+    }
+    EXPECT_EQ(my_map.order_of_key(2), 1U);
+    EXPECT_EQ(my_map.count(3), 1U);
+    EXPECT_EQ(my_map.count(4), 0U);
+}
+
+namespace {
+    // key that counts how many times it was constructed from outside the map
+    struct CountingKey {
+        static int constructed;
+        int value;
+        explicit CountingKey(int v) : value(v) { ++constructed; }
+        CountingKey(const CountingKey &other) : value(other.value) { ++constructed; }
+    };
+    int CountingKey::constructed = 0;
+
+    struct CountingKeyLess {
+        using is_transparent = void;
+        bool operator()(const CountingKey &a, const CountingKey &b) const { return a.value < b.value; }
+        bool operator()(const CountingKey &a, int b) const { return a.value < b; }
+        bool operator()(int a, const CountingKey &b) const { return a < b.value; }
+    };
+}  // namespace
+
+TEST(map, TransparentLookup) {
+    s21::map<std::string, int, std::less<>> my_map = {{"mary", 1}, {"rachel", 2}, {"bob", 5}};
+    std::string_view bob = "bob";
+    EXPECT_TRUE(my_map.contains(bob));
+    EXPECT_FALSE(my_map.contains("john"));
+    EXPECT_EQ(my_map.count(std::string_view("mary")), 1U);
+    EXPECT_EQ((*my_map.find(bob)).second, 5);
+    EXPECT_TRUE(my_map.find(std::string_view("zed")) == my_map.end());
+    my_map.at(std::string_view("rachel")) = 3;
+    EXPECT_EQ(my_map.at("rachel"), 3);
+    EXPECT_THROW(my_map.at(std::string_view("zed")), std::out_of_range);
+
+    s21::map<CountingKey, int, CountingKeyLess> counting_map;
+    for (int i = 0; i < 10; ++i) counting_map.insert(CountingKey(i), i);
+    CountingKey::constructed = 0;
+    EXPECT_TRUE(counting_map.contains(5));
+    EXPECT_EQ(counting_map.at(7), 7);
+    EXPECT_EQ(counting_map.count(11), 0U);
+    EXPECT_TRUE(counting_map.find(3) != counting_map.end());
+    EXPECT_EQ(CountingKey::constructed, 0);
+}
+
+namespace {
+    // value that counts how it was built
+    struct TrackedValue {
+        static int constructed;
+        static int copied;
+        static int moved;
+        std::vector<int> payload;
+
+        TrackedValue() { ++constructed; }
+        TrackedValue(int size, int fill) : payload(size, fill) { ++constructed; }
+        TrackedValue(const TrackedValue &other) : payload(other.payload) { ++copied; }
+        TrackedValue(TrackedValue &&other) noexcept : payload(std::move(other.payload)) { ++moved; }
+        TrackedValue &operator=(const TrackedValue &other) = default;
+
+        static void Reset() { constructed = copied = moved = 0; }
+    };
+    int TrackedValue::constructed = 0;
+    int TrackedValue::copied = 0;
+    int TrackedValue::moved = 0;
+}  // namespace
+
+TEST(map, EmplaceBuildsValueInPlace) {
+    s21::map<int, TrackedValue> my_map;
+    TrackedValue::Reset();
+    auto pr = my_map.try_emplace(1, 512, 7);
+    EXPECT_TRUE(pr.second);
+    EXPECT_EQ(TrackedValue::constructed, 1);
+    EXPECT_EQ(TrackedValue::copied + TrackedValue::moved, 0);
+    EXPECT_EQ(my_map.at(1).payload.size(), 512U);
+
+    TrackedValue::Reset();
+    pr = my_map.try_emplace(1, 1024, 0);
+    EXPECT_FALSE(pr.second);
+    EXPECT_EQ(TrackedValue::constructed + TrackedValue::copied + TrackedValue::moved, 0);
+    EXPECT_EQ((*pr.first).first, 1);
+
+    TrackedValue::Reset();
+    pr = my_map.emplace(2, TrackedValue(16, 1));
+    EXPECT_TRUE(pr.second);
+    EXPECT_EQ(TrackedValue::copied, 0);
+    EXPECT_EQ(TrackedValue::moved, 1);
+
+    TrackedValue::Reset();
+    pr = my_map.insert(std::make_pair(3, TrackedValue(16, 2)));
+    EXPECT_TRUE(pr.second);
+    EXPECT_EQ(TrackedValue::copied, 0);
+
+    TrackedValue::Reset();
+    my_map[4];
+    my_map[4];
+    EXPECT_EQ(TrackedValue::constructed, 1);
+    EXPECT_EQ(TrackedValue::copied + TrackedValue::moved, 0);
+
+    TrackedValue::Reset();
+    auto results = my_map.insert_many(std::make_pair(5, TrackedValue(8, 5)), std::make_pair(1, TrackedValue(8, 1)));
+    EXPECT_TRUE(results[0].second);
+    EXPECT_FALSE(results[1].second);
+    EXPECT_EQ(TrackedValue::copied, 0);
+    EXPECT_EQ(my_map.size(), 5U);
+}
+
+TEST(map, EmplaceConvertsKey) {
+    s21::map<std::string, int> my_map;
+    EXPECT_TRUE(my_map.emplace("one", 1).second);
+    EXPECT_FALSE(my_map.try_emplace(std::string("one"), 2).second);
+    EXPECT_EQ(my_map.at("one"), 1);
+}
+
+TEST(map, IteratorReturnsReferenceToStoredPair) {
+    s21::map<int, std::string> my_map{{1, "one"}, {2, "two"}, {3, "three"}};
+    auto it = my_map.find(2);
+    it->second += "!";
+    (*it).second += "?";
+    EXPECT_EQ(my_map.at(2), "two!?");
+    EXPECT_EQ(&*it, &*my_map.find(2));
+    EXPECT_EQ(&(*it).second, &my_map[2]);
+
+    for (auto i = my_map.begin(); i != my_map.end(); ++i) {
+        i->second = std::to_string(i->first);
+    }
+    EXPECT_EQ(my_map.at(1), "1");
+    EXPECT_EQ(my_map.at(3), "3");
+
+    auto last = my_map.end();
+    --last;
+    EXPECT_EQ(last->first, 3);
+}
+
+TEST(map, BulkBuildKeepsFirstOfEqualKeys) {
+    s21::map<int, std::string> my_map{{3, "c"}, {1, "a"}, {3, "x"}, {2, "b"}};
+    EXPECT_EQ(my_map.size(), 3U);
+    EXPECT_EQ(my_map.at(3), "c");
+
+    std::vector<std::pair<int, std::string>> rows;
+    for (int i = 0; i < 1000; ++i) rows.emplace_back(i, std::to_string(i));
+    s21::map<int, std::string> from_rows(rows.begin(), rows.end());
+    EXPECT_EQ(from_rows.size(), 1000U);
+    EXPECT_EQ(from_rows.find_by_order(500)->second, "500");
+    from_rows.assign_sorted(rows.rbegin(), rows.rbegin() + 10);
+    EXPECT_EQ(from_rows.size(), 10U);
+    EXPECT_EQ(from_rows.begin()->first, 990);
+}
+
+TEST(map, RangeScanWithBounds) {
+    s21::map<int, std::string> events;
+    for (int t = 0; t < 1000; t += 10) events.insert(t, std::to_string(t));
+    std::vector<int> seen;
+    for (auto it = events.lower_bound(95), end = events.upper_bound(150); it != end; ++it) {
+        seen.push_back(it->first);
+    }
+    EXPECT_EQ(seen, (std::vector<int>{100, 110, 120, 130, 140, 150}));
+
+    auto range = events.equal_range(500);
+    EXPECT_EQ(range.first->second, "500");
+    EXPECT_EQ(range.second->first, 510);
+    range = events.equal_range(505);
+    EXPECT_TRUE(range.first == range.second);
+    EXPECT_EQ(range.first->first, 510);
+    EXPECT_TRUE(events.lower_bound(991) == events.end());
+
+    s21::map<std::string, int, std::less<>> names{{"ann", 1}, {"bob", 2}};
+    EXPECT_EQ(names.lower_bound(std::string_view("b"))->second, 2);
+    EXPECT_TRUE(names.upper_bound(std::string_view("bob")) == names.end());
+}
+
+TEST(map, RangeEraseAndEraseIf) {
+    s21::map<int, std::string> ttl;
+    for (int t = 0; t < 100; ++t) ttl.insert(t, std::to_string(t));
+    auto it = ttl.erase(ttl.begin(), ttl.lower_bound(40));
+    EXPECT_EQ(it->first, 40);
+    EXPECT_EQ(ttl.size(), 60U);
+    EXPECT_EQ(ttl.begin()->second, "40");
+
+    size_t removed = s21::erase_if(ttl, [](const std::pair<const int, std::string> &entry) {
+        return entry.second.back() == '0';
+    });
+    EXPECT_EQ(removed, 6U);
+    EXPECT_EQ(ttl.size(), 54U);
+    EXPECT_FALSE(ttl.contains(50));
+    EXPECT_EQ(ttl.at(51), "51");
+}
+
+TEST(map, EndStepsBackToLastElement) {
+    s21::map<int, int> prices;
+    auto it = prices.end();
+    EXPECT_TRUE(prices.begin() == it);
+    for (int i = 10; i > 0; --i) prices.insert(i, i * 100);
+    it = prices.end();
+    --it;
+    EXPECT_EQ(it->first, 10);
+    prices.insert(20, 2000);
+    prices.insert(0, 0);
+    EXPECT_EQ(prices.begin()->first, 0);
+    it = prices.end();
+    --it;
+    EXPECT_EQ(it->second, 2000);
+
+    // после удаления крайних элементов begin() и --end() указывают на новых соседей
+    prices.erase(prices.begin());
+    prices.erase(prices.find(20));
+    it = prices.end();
+    --it;
+    EXPECT_EQ(prices.begin()->first, 1);
+    EXPECT_EQ(it->first, 10);
+
+    // обратный обход, начатый с end(), проходит все элементы
+    int expected = 10;
+    for (it = prices.end(); it != prices.begin();) {
+        --it;
+        EXPECT_EQ(it->first, expected--);
+    }
+    EXPECT_EQ(expected, 0);
+
+    s21::map<int, int> other{{50, 5}, {-5, 1}};
+    prices.merge(other);
+    it = prices.end();
+    --it;
+    EXPECT_EQ(it->first, 50);
+    EXPECT_EQ(prices.begin()->first, -5);
+    prices.clear();
+    EXPECT_TRUE(prices.begin() == prices.end());
+}
+
+TEST(map, HintedInsertAndEmplaceHint) {
+    s21::map<int, std::string> log;
+    for (int t = 0; t < 100; t += 2) log.insert(log.end(), {t, std::to_string(t)});
+    EXPECT_EQ(log.size(), 50U);
+    EXPECT_EQ(log.begin()->first, 0);
+
+    // ключ уже есть - возвращается итератор на него, значение не меняется
+    auto it = log.insert(log.find(10), {10, "ten"});
+    EXPECT_EQ(it->second, "10");
+    // вставка перед подсказкой и после нее, а также с подсказкой не в том месте
+    it = log.emplace_hint(log.find(12), 11, "11");
+    EXPECT_EQ(it->first, 11);
+    EXPECT_EQ((++it)->first, 12);
+    it = log.insert(log.find(12), {13, "13"});
+    EXPECT_EQ(it->second, "13");
+    it = log.emplace_hint(log.begin(), 97, "97");
+    EXPECT_EQ((++it)->first, 98);
+    it = log.emplace_hint(log.end(), std::make_pair(-1, std::string("-1")));
+    EXPECT_TRUE(it == log.begin());
+
+    EXPECT_EQ(log.size(), 54U);
+    int prev = -2;
+    for (auto entry : log) {
+        EXPECT_LT(prev, entry.first);
+        EXPECT_EQ(entry.second, std::to_string(entry.first));
+        prev = entry.first;
+    }
+}
+
+TEST(map, ExtractAndInsertNodeHandle) {
+    s21::map<int, std::string> active;
+    s21::map<int, std::string> expiring;
+    for (int id = 0; id < 10; ++id) active.insert(id, "session " + std::to_string(id));
+    const std::pair<const int, std::string> *address = &*active.find(3);
+
+    auto nh = active.extract(3);
+    EXPECT_FALSE(nh.empty());
+    EXPECT_EQ(nh.key(), 3);
+    EXPECT_EQ(nh.mapped(), "session 3");
+    EXPECT_EQ(active.size(), 9U);
+    EXPECT_FALSE(active.contains(3));
+    nh.mapped() += " (expiring)";
+    auto result = expiring.insert(std::move(nh));
+    EXPECT_TRUE(result.inserted);
+    EXPECT_TRUE(result.node.empty());
+    EXPECT_TRUE(nh.empty());
+    // узел тот же самый: пара не копировалась и не переезжала
+    EXPECT_EQ(&*result.position, address);
+    EXPECT_EQ(expiring.at(3), "session 3 (expiring)");
+
+    // ключ уже есть - узел возвращается в node
+    expiring.insert(5, "old");
+    result = expiring.insert(active.extract(active.find(5)));
+    EXPECT_FALSE(result.inserted);
+    EXPECT_EQ(result.position->second, "old");
+    EXPECT_EQ(result.node.mapped(), "session 5");
+    EXPECT_TRUE(active.extract(42).empty());
+
+    // исходное дерево очищено, пока узел в handle: память узла держит handle
+    nh = active.extract(active.begin());
+    active.clear();
+    auto it = expiring.insert(expiring.end(), std::move(nh));
+    EXPECT_EQ(it->second, "session 0");
+    EXPECT_EQ(expiring.size(), 3U);
+    EXPECT_EQ(expiring.begin()->first, 0);
+}
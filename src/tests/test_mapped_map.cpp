@@ -0,0 +1,147 @@
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+#include "test_entry.h"
+
+namespace {
+    const char kImagePath[] = "test_mapped_map.img";
+
+    // overwrites one byte of the file at offset
+    void DamageByte(const char *path, long offset) {
+        std::FILE *file = std::fopen(path, "r+b");
+        ASSERT_NE(file, nullptr);
+        std::fseek(file, offset, SEEK_SET);
+        int byte = std::fgetc(file);
+        std::fseek(file, offset, SEEK_SET);
+        std::fputc(byte ^ 0x5a, file);
+        std::fclose(file);
+    }
+
+    // writes count into the header and signs it with a correct header checksum
+    void ForgeCount(const char *path, uint64_t count) {
+        std::FILE *file = std::fopen(path, "r+b");
+        ASSERT_NE(file, nullptr);
+        s21::ImageHeader header{};
+        ASSERT_EQ(std::fread(&header, sizeof(header), 1, file), 1U);
+        header.count_ = count;
+        header.header_checksum_ = s21::HeaderChecksum(header);
+        std::fseek(file, 0, SEEK_SET);
+        std::fwrite(&header, sizeof(header), 1, file);
+        std::fclose(file);
+    }
+} // namespace
+
+TEST(mapped_map, LookupsMatchWrittenMap) {
+    s21::map<uint64_t, uint64_t> source;
+    std::map<uint64_t, uint64_t> orig;
+    for (uint64_t i = 0; i < 5000; ++i) {
+        source.insert(i * 7, i * i);
+        orig.insert({i * 7, i * i});
+    }
+    const s21::map<uint64_t, uint64_t> &loaded = source; // образ пишется и из константного словаря
+    s21::write_image(loaded, kImagePath);
+
+    s21::mapped_map<uint64_t, uint64_t> view(kImagePath);
+    EXPECT_EQ(view.size(), orig.size());
+    EXPECT_TRUE(view.verify());
+    EXPECT_EQ(view.at(700), 10000U);
+    EXPECT_TRUE(view.contains(34993));
+    EXPECT_FALSE(view.contains(34994));
+    EXPECT_TRUE(view.find(5) == view.end());
+    EXPECT_EQ(view.find(14)->second, 4U);
+    EXPECT_THROW(view.at(1), std::out_of_range);
+    EXPECT_EQ(view.lower_bound(8)->first, 14U);
+    EXPECT_EQ(view.upper_bound(14)->first, 21U);
+    EXPECT_TRUE(view.lower_bound(100000) == view.end());
+
+    auto expected = orig.begin();
+    for (auto entry : view) {
+        EXPECT_EQ(entry.first, expected->first);
+        EXPECT_EQ(entry.second, expected->second);
+        ++expected;
+    }
+    EXPECT_TRUE(expected == orig.end());
+
+    // отсортированный образ собирается обратно в map за O(n)
+    s21::map<uint64_t, uint64_t> restored(view.begin(), view.end());
+    EXPECT_EQ(restored.size(), 5000U);
+    EXPECT_EQ(restored.at(34993), 4999U * 4999U);
+    std::remove(kImagePath);
+}
+
+TEST(mapped_map, EmptyMapAndMove) {
+    s21::map<int, double> source;
+    s21::write_image(source, kImagePath);
+    s21::mapped_map<int, double> view(kImagePath);
+    EXPECT_TRUE(view.empty());
+    EXPECT_TRUE(view.begin() == view.end());
+    EXPECT_FALSE(view.contains(0));
+
+    source.insert(1, 0.5);
+    s21::write_image(source, kImagePath); // the open view keeps the old file
+    s21::mapped_map<int, double> moved(std::move(view));
+    EXPECT_TRUE(moved.empty());
+    moved = s21::mapped_map<int, double>(kImagePath);
+    EXPECT_EQ(moved.at(1), 0.5);
+    std::remove(kImagePath);
+}
+
+TEST(mapped_map, RejectsBadImages) {
+    using view_type = s21::mapped_map<uint64_t, uint64_t>;
+    EXPECT_THROW(view_type("no_such_file.img"), std::runtime_error);
+
+    s21::map<uint64_t, uint64_t> source;
+    for (uint64_t i = 0; i < 100; ++i) source.insert(i, i);
+    s21::write_image(source, kImagePath);
+    EXPECT_THROW((s21::mapped_map<uint32_t, uint64_t>(kImagePath)), std::runtime_error);
+    EXPECT_THROW((s21::mapped_set<uint64_t>(kImagePath)), std::runtime_error);
+
+    // порча данных видна только verify(), порча заголовка - уже при открытии
+    DamageByte(kImagePath, 300);
+    EXPECT_FALSE(view_type(kImagePath).verify());
+    DamageByte(kImagePath, 20);
+    EXPECT_THROW((view_type(kImagePath)), std::runtime_error);
+
+    s21::write_image(source, kImagePath);
+    {
+        std::ofstream file(kImagePath, std::ios::binary | std::ios::app);
+        file << "tail";
+    }
+    EXPECT_THROW((view_type(kImagePath)), std::runtime_error);
+
+    // count_ * sizeof(key) переполняется и без проверки делением выглядел бы как маленький массив
+    s21::write_image(source, kImagePath);
+    ForgeCount(kImagePath, uint64_t(1) << 61);
+    EXPECT_THROW((view_type(kImagePath)), std::runtime_error);
+    ForgeCount(kImagePath, 105);
+    EXPECT_THROW((view_type(kImagePath)), std::runtime_error);
+    ForgeCount(kImagePath, 100);
+    EXPECT_EQ(view_type(kImagePath).size(), 100U);
+    std::remove(kImagePath);
+}
+
+TEST(mapped_map, ConcurrentWritersKeepTheImageWhole) {
+    s21::map<uint64_t, uint64_t> small;
+    s21::map<uint64_t, uint64_t> large;
+    for (uint64_t i = 0; i < 10; ++i) small.insert(i, 1);
+    for (uint64_t i = 0; i < 100000; ++i) large.insert(i, 2);
+    // у каждого писателя свой временный файл, поэтому образ целиком от одного из них
+    std::thread writer([&large] {
+        for (int i = 0; i < 5; ++i) s21::write_image(large, kImagePath);
+    });
+    for (int i = 0; i < 5; ++i) s21::write_image(small, kImagePath);
+    writer.join();
+    s21::mapped_map<uint64_t, uint64_t> view(kImagePath);
+    EXPECT_TRUE(view.verify());
+    EXPECT_TRUE(view.size() == small.size() || view.size() == large.size());
+    EXPECT_EQ(view.at(5), view.size() == small.size() ? 1U : 2U);
+    std::remove(kImagePath);
+
+    EXPECT_THROW(s21::write_image(small, "no_such_directory/map.img"), std::runtime_error);
+}
@@ -0,0 +1,29 @@
+#include <cstdint>
+#include <cstdio>
+#include <set>
+
+#include "test_entry.h"
+
+TEST(mapped_set, LookupsMatchWrittenSet) {
+    const char path[] = "test_mapped_set.img";
+    s21::set<int32_t> source;
+    std::set<int32_t> orig;
+    for (int32_t i = -1000; i < 1000; i += 3) {
+        source.insert(i);
+        orig.insert(i);
+    }
+    const s21::set<int32_t> &loaded = source;
+    s21::write_image(loaded, path);
+
+    s21::mapped_set<int32_t> view(path);
+    EXPECT_TRUE(view.verify());
+    EXPECT_EQ(view.size(), orig.size());
+    EXPECT_TRUE(std::equal(view.begin(), view.end(), orig.begin(), orig.end()));
+    EXPECT_TRUE(view.contains(-1000));
+    EXPECT_FALSE(view.contains(0));
+    EXPECT_EQ(view.count(998), 1U);
+    EXPECT_EQ(*view.lower_bound(0), 2);
+    EXPECT_EQ(*view.upper_bound(2), 5);
+    EXPECT_TRUE(view.find(1000) == view.end());
+    std::remove(path);
+}
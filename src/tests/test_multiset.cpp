@@ -0,0 +1,248 @@
+#include <cstdlib>
+#include <iterator>
+#include <set>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "test_entry.h"
+
+namespace {
+    // Exposes the tree internals needed to check the AVL invariant
+    template <typename Key>
+    class MultisetProbe : public s21::multiset<Key> {
+    public:
+        bool IsBalanced() const { return CheckNode(this->root_, nullptr) >= 0; }
+
+    private:
+        // returns the subtree height or -1 if the subtree violates the AVL invariant
+        // or has a wrong parent link or subtree size
+        int CheckNode(typename s21::multiset<Key>::Node *node, typename s21::multiset<Key>::Node *parent) const {
+            if (node == nullptr) return 0;
+            if (node->parent_ != parent) return -1;
+            int left = CheckNode(node->left_, node);
+            int right = CheckNode(node->right_, node);
+            if (left < 0 || right < 0 || std::abs(left - right) > 1) return -1;
+            size_t left_size = node->left_ == nullptr ? 0 : node->left_->size_;
+            size_t right_size = node->right_ == nullptr ? 0 : node->right_->size_;
+            if (node->size_ != left_size + right_size + 1) return -1;
+            int height = std::max(left, right) + 1;
+            return height == node->height_ ? height : -1;
+        }
+    };
+
+    template <typename Multiset>
+    std::vector<int> Contents(Multiset &container) {
+        return std::vector<int>(container.begin(), container.end());
+    }
+
+    // ключ - первое поле, второе показывает, какая это копия
+    struct ByFirst {
+        bool operator()(const std::pair<int, int> &lhs, const std::pair<int, int> &rhs) const {
+            return lhs.first < rhs.first;
+        }
+    };
+}  // namespace
+
+TEST(multiset, KeepsRepeatedValues) {
+    s21::multiset<int> my_multiset = {3, 1, 3, 2, 3, 1};
+    std::multiset<int> orig_multiset = {3, 1, 3, 2, 3, 1};
+    EXPECT_EQ(my_multiset.size(), orig_multiset.size());
+    EXPECT_EQ(Contents(my_multiset), std::vector<int>(orig_multiset.begin(), orig_multiset.end()));
+    auto it = my_multiset.insert(2);
+    EXPECT_EQ(*it, 2);
+    EXPECT_EQ(*--it, 2);
+    EXPECT_EQ(*--it, 1);
+    EXPECT_EQ(my_multiset.size(), 7U);
+}
+
+TEST(multiset, EqualKeysKeepInsertionOrder) {
+    s21::multiset<std::pair<int, int>, ByFirst> my_multiset;
+    for (int i = 0; i < 5; ++i) {
+        my_multiset.insert({1, i});
+        my_multiset.insert({0, i});
+    }
+    auto range = my_multiset.equal_range({1, -1});
+    int copy = 0;
+    for (auto it = range.first; it != range.second; ++it, ++copy) {
+        EXPECT_EQ(it->second, copy);
+    }
+    EXPECT_EQ(copy, 5);
+    EXPECT_EQ(my_multiset.find({0, -1})->second, 0);
+    // unsorted input is sorted stably
+    std::vector<std::pair<int, int>> items = {{2, 0}, {1, 0}, {2, 1}, {1, 1}, {2, 2}};
+    s21::multiset<std::pair<int, int>, ByFirst> built(items.begin(), items.end());
+    std::vector<std::pair<int, int>> expected = {{1, 0}, {1, 1}, {2, 0}, {2, 1}, {2, 2}};
+    std::vector<std::pair<int, int>> contents(built.begin(), built.end());
+    EXPECT_EQ(contents, expected);
+}
+
+TEST(multiset, CountAndBoundsMatchStdMultiset) {
+    MultisetProbe<int> my_multiset;
+    std::multiset<int> orig_multiset;
+    std::srand(18);
+    for (int i = 0; i < 5000; ++i) {
+        int value = std::rand() % 100;
+        my_multiset.insert(value);
+        orig_multiset.insert(value);
+    }
+    EXPECT_TRUE(my_multiset.IsBalanced());
+    for (int key = -1; key <= 100; ++key) {
+        EXPECT_EQ(my_multiset.count(key), orig_multiset.count(key));
+        auto my_range = my_multiset.equal_range(key);
+        auto orig_range = orig_multiset.equal_range(key);
+        EXPECT_EQ(std::distance(my_range.first, my_range.second), std::distance(orig_range.first, orig_range.second));
+        EXPECT_EQ(my_multiset.order_of_key(key),
+                  static_cast<size_t>(std::distance(orig_multiset.begin(), orig_multiset.lower_bound(key))));
+        EXPECT_TRUE(my_range.first == my_multiset.lower_bound(key));
+        EXPECT_TRUE(my_range.second == my_multiset.upper_bound(key));
+        EXPECT_EQ(my_multiset.contains(key), orig_multiset.count(key) != 0);
+    }
+}
+
+TEST(multiset, EraseByIteratorAndKey) {
+    MultisetProbe<int> my_multiset;
+    std::multiset<int> orig_multiset;
+    for (int i = 0; i < 3000; ++i) {
+        my_multiset.insert(i % 30);
+        orig_multiset.insert(i % 30);
+    }
+    my_multiset.erase(my_multiset.find(7));
+    orig_multiset.erase(orig_multiset.find(7));
+    EXPECT_EQ(my_multiset.count(7), 99U);
+    EXPECT_EQ(my_multiset.erase(5), orig_multiset.erase(5));
+    EXPECT_EQ(my_multiset.erase(5), 0U);
+    EXPECT_TRUE(my_multiset.erase(my_multiset.lower_bound(10), my_multiset.upper_bound(12)) == my_multiset.find(13));
+    orig_multiset.erase(orig_multiset.lower_bound(10), orig_multiset.upper_bound(12));
+    size_t odd = 0;
+    for (auto it = orig_multiset.begin(); it != orig_multiset.end();) {
+        if (*it % 2 == 1) {
+            it = orig_multiset.erase(it);
+            ++odd;
+        } else {
+            ++it;
+        }
+    }
+    EXPECT_EQ(s21::erase_if(my_multiset, [](int value) { return value % 2 == 1; }), odd);
+    EXPECT_TRUE(my_multiset.IsBalanced());
+    EXPECT_EQ(Contents(my_multiset), std::vector<int>(orig_multiset.begin(), orig_multiset.end()));
+}
+
+TEST(multiset, EmplaceAndInsertMany) {
+    s21::multiset<std::string> my_multiset;
+    auto result = my_multiset.insert_many("ok", "error", "ok", "ok");
+    ASSERT_EQ(result.size(), 4U);
+    EXPECT_EQ(*result[0], "ok");
+    EXPECT_EQ(*result[1], "error");
+    EXPECT_EQ(my_multiset.count("ok"), 3U);
+    EXPECT_EQ(*my_multiset.emplace(3, 'x'), "xxx");
+    EXPECT_EQ(my_multiset.size(), 5U);
+}
+
+TEST(multiset, CopyAndMove) {
+    s21::multiset<int> my_multiset = {1, 1, 2};
+    s21::multiset<int> copy(my_multiset);
+    s21::multiset<int> moved(std::move(my_multiset));
+    copy.insert(1);
+    EXPECT_EQ(copy.count(1), 3U);
+    EXPECT_EQ(moved.count(1), 2U);
+    EXPECT_TRUE(my_multiset.empty());
+}
+
+TEST(multiset, CompactStoresOneNodePerKey) {
+    s21::multiset<int, std::less<int>, true> my_multiset;
+    std::multiset<int> orig_multiset;
+    std::srand(7);
+    for (int i = 0; i < 100000; ++i) {
+        int status = std::rand() % 5 * 100;
+        my_multiset.insert(status);
+        orig_multiset.insert(status);
+    }
+    EXPECT_EQ(my_multiset.size(), orig_multiset.size());
+    EXPECT_EQ(my_multiset.distinct_size(), 5U);
+    EXPECT_EQ(Contents(my_multiset), std::vector<int>(orig_multiset.begin(), orig_multiset.end()));
+    for (int key = 0; key <= 500; key += 50) {
+        EXPECT_EQ(my_multiset.count(key), orig_multiset.count(key));
+        auto my_range = my_multiset.equal_range(key);
+        EXPECT_EQ(static_cast<size_t>(std::distance(my_range.first, my_range.second)), orig_multiset.count(key));
+        EXPECT_TRUE(my_range.first == my_multiset.lower_bound(key));
+        EXPECT_TRUE(my_range.second == my_multiset.upper_bound(key));
+    }
+    // обратный обход тоже проходит каждую копию
+    std::vector<int> reversed;
+    for (auto it = my_multiset.end(); it != my_multiset.begin();) {
+        reversed.push_back(*--it);
+    }
+    EXPECT_EQ(reversed, std::vector<int>(orig_multiset.rbegin(), orig_multiset.rend()));
+}
+
+TEST(multiset, CompactInsertAndErase) {
+    s21::multiset<int, std::less<int>, true> my_multiset = {2, 1, 2, 3, 2};
+    EXPECT_EQ(my_multiset.size(), 5U);
+    EXPECT_EQ(my_multiset.distinct_size(), 3U);
+    auto it = my_multiset.insert(1);
+    EXPECT_EQ(*it, 1);
+    EXPECT_EQ(*++it, 2);
+    EXPECT_TRUE(it == my_multiset.find(2));
+    my_multiset.erase(my_multiset.find(2));
+    EXPECT_EQ(my_multiset.count(2), 2U);
+    my_multiset.erase(my_multiset.find(3));
+    EXPECT_FALSE(my_multiset.contains(3));
+    EXPECT_EQ(my_multiset.distinct_size(), 2U);
+    EXPECT_EQ(my_multiset.erase(1), 2U);
+    EXPECT_EQ(my_multiset.erase(1), 0U);
+    EXPECT_EQ(Contents(my_multiset), std::vector<int>({2, 2}));
+    EXPECT_TRUE(my_multiset.find(7) == my_multiset.end());
+
+    auto result = my_multiset.insert_many(4, 2, 4);
+    EXPECT_EQ(*result[0], 4);
+    EXPECT_EQ(Contents(my_multiset), std::vector<int>({2, 2, 2, 4, 4}));
+    s21::multiset<int, std::less<int>, true> moved(std::move(my_multiset));
+    EXPECT_TRUE(my_multiset.empty());
+    EXPECT_EQ(my_multiset.size(), 0U);
+    EXPECT_EQ(moved.size(), 5U);
+    moved.clear();
+    EXPECT_TRUE(moved.begin() == moved.end());
+}
+
+TEST(multiset, CompactEraseWhileIterating) {
+    s21::multiset<int, std::less<int>, true> my_multiset = {5, 5, 7};
+    for (auto it = my_multiset.begin(); it != my_multiset.end();) {
+        auto cur = it++;
+        my_multiset.erase(cur);
+    }
+    EXPECT_TRUE(my_multiset.empty());
+    EXPECT_EQ(my_multiset.distinct_size(), 0U);
+
+    my_multiset = {1, 5, 5, 5, 7, 7};
+    std::vector<int> kept;
+    for (auto it = my_multiset.begin(); it != my_multiset.end();) {
+        if (*it != 1 && (kept.empty() || kept.back() != *it)) {
+            kept.push_back(*it);
+            ++it;
+        } else {
+            it = my_multiset.erase(it);
+        }
+    }
+    EXPECT_EQ(kept, std::vector<int>({5, 7}));
+    EXPECT_EQ(Contents(my_multiset), std::vector<int>({5, 7}));
+    EXPECT_EQ(my_multiset.size(), 2U);
+}
+
+TEST(multiset, CompactConstAndTransparentLookups) {
+    s21::multiset<std::string, std::less<>, true> my_multiset = {"b", "a", "b", "c"};
+    const auto &view = my_multiset;
+    EXPECT_EQ(view.size(), 4U);
+    EXPECT_FALSE(view.empty());
+    EXPECT_EQ(view.distinct_size(), 3U);
+    EXPECT_EQ(view.count("b"), 2U);
+    EXPECT_TRUE(view.contains(std::string_view("c")));
+    EXPECT_FALSE(view.contains("d"));
+    EXPECT_EQ(*my_multiset.find(std::string_view("b")), "b");
+    EXPECT_EQ(*my_multiset.lower_bound("bb"), "c");
+    EXPECT_TRUE(my_multiset.upper_bound("c") == my_multiset.end());
+    auto range = my_multiset.equal_range(std::string_view("b"));
+    EXPECT_EQ(std::distance(range.first, range.second), 2);
+    range = my_multiset.equal_range("bb");
+    EXPECT_TRUE(range.first == range.second);
+}
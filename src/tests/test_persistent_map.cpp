@@ -0,0 +1,144 @@
+#include <cstdlib>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "test_entry.h"
+
+namespace {
+    // Exposes the nodes of a version to check the AVL invariant
+    class PersistentMapProbe : public s21::persistent_map<int, int> {
+    public:
+        explicit PersistentMapProbe(const s21::persistent_map<int, int> &version)
+                : s21::persistent_map<int, int>(version) {}
+        bool IsBalanced() const { return CheckNode(root_.get()) >= 0; }
+
+    private:
+        // returns the subtree height or -1 if the subtree violates the AVL invariant or has a wrong size
+        static int CheckNode(const Node *node) {
+            if (node == nullptr) return 0;
+            int left = CheckNode(node->left_.get());
+            int right = CheckNode(node->right_.get());
+            if (left < 0 || right < 0 || std::abs(left - right) > 1) return -1;
+            size_t left_size = node->left_ == nullptr ? 0 : node->left_->size_;
+            size_t right_size = node->right_ == nullptr ? 0 : node->right_->size_;
+            if (node->size_ != left_size + right_size + 1) return -1;
+            int height = std::max(left, right) + 1;
+            return height == node->height_ ? height : -1;
+        }
+    };
+
+    template <typename Map>
+    std::vector<std::pair<int, int>> Contents(const Map &map) {
+        std::vector<std::pair<int, int>> items;
+        for (auto it = map.begin(); it != map.end(); ++it) {
+            items.emplace_back(it->first, it->second);
+        }
+        return items;
+    }
+}  // namespace
+
+TEST(persistent_map, InsertReturnsNewVersion) {
+    s21::persistent_map<int, std::string> empty;
+    auto one = empty.insert(1, "one");
+    auto two = one.insert({2, "two"});
+    EXPECT_TRUE(empty.empty());
+    EXPECT_EQ(one.size(), 1U);
+    EXPECT_EQ(two.size(), 2U);
+    EXPECT_FALSE(one.contains(2));
+    EXPECT_EQ(two.at(2), "two");
+    // insert keeps the present value, insert_or_assign replaces it in the new version only
+    EXPECT_EQ(two.insert(1, "uno").at(1), "one");
+    auto three = two.insert_or_assign(1, "uno");
+    EXPECT_EQ(three.at(1), "uno");
+    EXPECT_EQ(two.at(1), "one");
+    EXPECT_THROW(two.at(3), std::out_of_range);
+}
+
+TEST(persistent_map, VersionsMatchStdMap) {
+    std::srand(19);
+    s21::persistent_map<int, int> version;
+    std::map<int, int> orig_map;
+    std::vector<std::pair<s21::persistent_map<int, int>, std::map<int, int>>> history;
+    for (int i = 0; i < 6000; ++i) {
+        int key = std::rand() % 1000;
+        if (std::rand() % 3 == 0) {
+            version = version.erase(key);
+            orig_map.erase(key);
+        } else {
+            version = version.insert_or_assign(key, i);
+            orig_map[key] = i;
+        }
+        if (i % 500 == 0) {
+            history.emplace_back(version.snapshot(), orig_map);
+        }
+    }
+    EXPECT_TRUE(PersistentMapProbe(version).IsBalanced());
+    EXPECT_EQ(version.size(), orig_map.size());
+    EXPECT_EQ(Contents(version), Contents(orig_map));
+    // every old version still holds what it held when it was taken
+    for (auto &entry : history) {
+        EXPECT_TRUE(PersistentMapProbe(entry.first).IsBalanced());
+        EXPECT_EQ(Contents(entry.first), Contents(entry.second));
+    }
+}
+
+TEST(persistent_map, UnchangedNodesAreShared) {
+    std::vector<std::pair<const int, int>> items;
+    for (int i = 0; i < 1000; ++i) {
+        items.emplace_back(i, i * 10);
+    }
+    s21::persistent_map<int, int> base(items.begin(), items.end());
+    EXPECT_TRUE(PersistentMapProbe(base).IsBalanced());
+    auto changed = base.insert_or_assign(0, -1).erase(999);
+    EXPECT_EQ(changed.size(), 999U);
+    EXPECT_EQ(&base.at(600), &changed.at(600)); // 600 is off the copied paths
+    EXPECT_NE(&base.at(0), &changed.at(0));
+    EXPECT_EQ(base.at(0), 0);
+    EXPECT_EQ(base.at(999), 9990);
+    EXPECT_TRUE(base.erase(5000).find(5) != base.end());
+}
+
+TEST(persistent_map, FindAndLowerBound) {
+    s21::persistent_map<int, int> map = {{30, 3}, {10, 1}, {20, 2}, {10, 100}};
+    EXPECT_EQ(map.size(), 3U);
+    EXPECT_EQ(map.at(10), 1);
+    EXPECT_EQ(map.find(20)->second, 2);
+    EXPECT_TRUE(map.find(25) == map.end());
+    EXPECT_EQ(map.lower_bound(11)->first, 20);
+    EXPECT_EQ(map.lower_bound(20)->first, 20);
+    EXPECT_TRUE(map.lower_bound(31) == map.end());
+    auto it = map.lower_bound(0);
+    EXPECT_EQ((it++)->first, 10);
+    EXPECT_EQ((++it)->first, 30);
+    EXPECT_EQ(map.count(30), 1U);
+}
+
+TEST(persistent_map, SnapshotsAreReadFromOtherThreads) {
+    s21::persistent_map<int, int> version;
+    for (int i = 0; i < 10000; ++i) {
+        version = version.insert(i, i);
+    }
+    std::vector<std::thread> readers;
+    std::vector<long long> sums(4, 0);
+    for (size_t t = 0; t < sums.size(); ++t) {
+        readers.emplace_back([snapshot = version.snapshot(), &sums, t] {
+            for (const auto &item : snapshot) {
+                sums[t] += item.second;
+            }
+        });
+    }
+    // тем временем пишущий поток продолжает строить новые версии из тех же узлов
+    for (int i = 0; i < 10000; i += 2) {
+        version = version.erase(i);
+    }
+    for (auto &reader : readers) {
+        reader.join();
+    }
+    for (long long sum : sums) {
+        EXPECT_EQ(sum, 10000LL * 9999 / 2);
+    }
+    EXPECT_EQ(version.size(), 5000U);
+}
@@ -1,4 +1,13 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iterator>
 #include <set>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
 #include "test_entry.h"
 
 TEST(set, ConstructorDefaultSet) {
@@ -167,4 +176,547 @@ TEST(set, ConstructorDefaultSet) {
 //s21::set<double> orig_set = {2.1, 2.2, 2.3, 2.4, 2.5, 2.6};
 //EXPECT_EQ(my_set.contains(2), orig_set.contains(2));
 //EXPECT_EQ(my_set.contains(2.1), orig_set.contains(2.1));
-//}
\ No newline at end of file
+//}
+namespace {
+    // Exposes the tree internals needed to check the AVL invariant
+    template <typename Key>
+    class SetProbe : public s21::set<Key> {
+    public:
+        int Height() const { return this->root_ == nullptr ? 0 : this->root_->height_; }
+        bool IsBalanced() const { return CheckNode(this->root_, nullptr) >= 0; }
+
+    private:
+        // returns the subtree height or -1 if the subtree violates the AVL invariant
+        // or has a wrong parent link or subtree size
+        int CheckNode(typename s21::set<Key>::Node *node, typename s21::set<Key>::Node *parent) const {
+            if (node == nullptr) return 0;
+            if (node->parent_ != parent) return -1;
+            int left = CheckNode(node->left_, node);
+            int right = CheckNode(node->right_, node);
+            if (left < 0 || right < 0 || std::abs(left - right) > 1) return -1;
+            size_t left_size = node->left_ == nullptr ? 0 : node->left_->size_;
+            size_t right_size = node->right_ == nullptr ? 0 : node->right_->size_;
+            if (node->size_ != left_size + right_size + 1) return -1;
+            int height = std::max(left, right) + 1;
+            return height == node->height_ ? height : -1;
+        }
+    };
+}  // namespace
+
+TEST(set, BalancedAfterSortedInsert) {
+    const int count = 1000000;
+    SetProbe<int> my_set;
+    for (int i = 0; i < count; ++i) {
+        my_set.insert(i);
+    }
+    EXPECT_EQ(my_set.size(), static_cast<size_t>(count));
+    // AVL height bound: h < 1.4405 * log2(n + 2)
+    EXPECT_LT(my_set.Height(), 1.4405 * std::log2(count + 2.0));
+    EXPECT_TRUE(my_set.IsBalanced());
+    int expected = 0;
+    for (auto it = my_set.begin(); it != my_set.end(); ++it, ++expected) {
+        EXPECT_EQ(*it, expected);
+    }
+}
+
+TEST(set, BalancedAfterErase) {
+    SetProbe<int> my_set;
+    for (int i = 0; i < 1000; ++i) {
+        my_set.insert(i);
+    }
+    for (int i = 0; i < 1000; i += 3) {
+        my_set.erase(my_set.find(i));
+        EXPECT_TRUE(my_set.IsBalanced());
+    }
+    EXPECT_EQ(my_set.size(), static_cast<size_t>(666));
+    EXPECT_FALSE(my_set.contains(0));
+    EXPECT_TRUE(my_set.contains(1));
+    EXPECT_LT(my_set.Height(), 1.4405 * std::log2(666 + 2.0));
+}
+
+TEST(set, OrderStatistics) {
+    SetProbe<int> my_set;
+    std::set<int> orig_set;
+    std::srand(21);
+    for (int i = 0; i < 2000; ++i) {
+        int value = std::rand() % 5000;
+        my_set.insert(value);
+        orig_set.insert(value);
+    }
+    for (int i = 0; i < 2000; i += 7) {
+        auto it = orig_set.find(i);
+        if (it != orig_set.end()) {
+            orig_set.erase(it);
+            my_set.erase(my_set.find(i));
+        }
+    }
+    EXPECT_TRUE(my_set.IsBalanced());
+    ASSERT_EQ(my_set.size(), orig_set.size());
+    size_t k = 0;
+    for (auto orig_it = orig_set.begin(); orig_it != orig_set.end(); ++orig_it, ++k) {
+        EXPECT_EQ(*my_set.find_by_order(k), *orig_it);
+        EXPECT_EQ(my_set.order_of_key(*orig_it), k);
+    }
+    EXPECT_TRUE(my_set.find_by_order(orig_set.size()) == my_set.end());
+    EXPECT_EQ(my_set.order_of_key(-1), 0U);
+    EXPECT_EQ(my_set.order_of_key(100000), orig_set.size());
+    EXPECT_EQ(my_set.order_of_key(4000),
+              static_cast<size_t>(std::distance(orig_set.begin(), orig_set.lower_bound(4000))));
+}
+
+TEST(set, RandomInsertEraseKeepsInvariants) {
+    SetProbe<int> my_set;
+    std::set<int> orig_set;
+    std::srand(5);
+    for (int i = 0; i < 20000; ++i) {
+        int value = std::rand() % 3000;
+        if (std::rand() % 3 == 0) {
+            auto my_it = my_set.find(value);
+            EXPECT_EQ(my_it != my_set.end(), orig_set.erase(value) == 1);
+            my_set.erase(my_it);
+        } else {
+            EXPECT_EQ(my_set.insert(value).second, orig_set.insert(value).second);
+        }
+    }
+    EXPECT_TRUE(my_set.IsBalanced());
+    ASSERT_EQ(my_set.size(), orig_set.size());
+    auto my_it = my_set.begin();
+    for (auto orig_it = orig_set.begin(); orig_it != orig_set.end(); ++orig_it, ++my_it) {
+        EXPECT_EQ(*my_it, *orig_it);
+    }
+}
+
+TEST(set, EraseKeepsOtherIteratorsValid) {
+    s21::set<int> my_set;
+    for (int i = 0; i < 100; ++i) my_set.insert(i);
+    auto kept = my_set.find(51);
+    // 50 has two children, so its successor 51 is moved into its place
+    my_set.erase(my_set.find(50));
+    EXPECT_EQ(*kept, 51);
+    ++kept;
+    EXPECT_EQ(*kept, 52);
+}
+
+TEST(set, CopyAndDestroyLargeSet) {
+    SetProbe<int> my_set;
+    for (int i = 0; i < 200000; ++i) my_set.insert(i);
+    {
+        SetProbe<int> my_copy(my_set);
+        EXPECT_EQ(my_copy.size(), my_set.size());
+        EXPECT_EQ(my_copy.Height(), my_set.Height());
+        EXPECT_TRUE(my_copy.IsBalanced());
+        EXPECT_EQ(my_copy.order_of_key(150000), 150000U);
+        my_copy.erase(my_copy.begin());
+        EXPECT_EQ(*my_copy.begin(), 1);
+        EXPECT_EQ(*my_set.begin(), 0);
+    }
+    my_set.clear();
+    EXPECT_TRUE(my_set.empty());
+}
+
+TEST(set, TransparentFind) {
+    s21::set<std::string, std::less<>> my_set;
+    my_set.insert("alpha");
+    my_set.insert("beta");
+    EXPECT_EQ(*my_set.find(std::string_view("beta")), "beta");
+    EXPECT_TRUE(my_set.contains("alpha"));
+    EXPECT_EQ(my_set.count(std::string_view("gamma")), 0U);
+}
+
+TEST(set, EmplaceAndInsertMany) {
+    s21::set<std::string> my_set;
+    EXPECT_TRUE(my_set.emplace(3, 'a').second);
+    EXPECT_FALSE(my_set.emplace("aaa").second);
+    std::string moved = "moved";
+    EXPECT_TRUE(my_set.insert(std::move(moved)).second);
+    auto results = my_set.insert_many("b", std::string("c"), "b");
+    EXPECT_TRUE(results[0].second);
+    EXPECT_TRUE(results[1].second);
+    EXPECT_FALSE(results[2].second);
+    EXPECT_EQ(*results[2].first, "b");
+    EXPECT_EQ(my_set.size(), 4U);
+}
+
+namespace {
+    // Counts how many times keys are copied into the container
+    struct CopyCountedKey {
+        static inline int copies = 0;
+        int value;
+        CopyCountedKey(int v = 0) : value(v) {}
+        CopyCountedKey(const CopyCountedKey &other) : value(other.value) { ++copies; }
+        CopyCountedKey(CopyCountedKey &&other) noexcept = default;
+        bool operator<(const CopyCountedKey &other) const { return value < other.value; }
+    };
+}  // namespace
+
+TEST(set, NodeStoresKeyOnce) {
+    s21::set<CopyCountedKey> my_set;
+    CopyCountedKey key(5);
+    CopyCountedKey::copies = 0;
+    EXPECT_TRUE(my_set.insert(key).second);
+    EXPECT_EQ(CopyCountedKey::copies, 1);
+    EXPECT_FALSE(my_set.insert(key).second);
+    EXPECT_EQ(CopyCountedKey::copies, 1);
+    EXPECT_TRUE(my_set.insert(CopyCountedKey(7)).second);
+    EXPECT_EQ(CopyCountedKey::copies, 1);
+    EXPECT_EQ((*my_set.find(CopyCountedKey(7))).value, 7);
+}
+
+TEST(set, MergeSplicesNodes) {
+    // sizes pick both the per-node path (small other) and the linear rebuild (comparable sizes)
+    for (int other_count : {10, 3000}) {
+        SetProbe<int> my_set;
+        SetProbe<int> other;
+        for (int i = 0; i < 6000; i += 2) my_set.insert(i);
+        for (int i = 0; i < other_count; ++i) other.insert(i * 3);
+        std::set<int> expected(my_set.begin(), my_set.end());
+        std::set<int> expected_rest;
+        for (int value : other) {
+            if (!expected.insert(value).second) expected_rest.insert(value);
+        }
+        const int *moved_address = &*other.find(3);
+
+        my_set.merge(other);
+        EXPECT_TRUE(my_set.IsBalanced());
+        EXPECT_TRUE(other.IsBalanced());
+        EXPECT_EQ(my_set.size(), expected.size());
+        EXPECT_EQ(other.size(), expected_rest.size());
+        EXPECT_TRUE(std::equal(my_set.begin(), my_set.end(), expected.begin()));
+        EXPECT_TRUE(std::equal(other.begin(), other.end(), expected_rest.begin()));
+        // the node itself moved, nothing was copied
+        EXPECT_EQ(&*my_set.find(3), moved_address);
+    }
+}
+
+TEST(set, MergedNodesOutliveDonor) {
+    s21::set<std::string> result;
+    for (int round = 0; round < 3; ++round) {
+        s21::set<std::string> shard;
+        for (int i = 0; i < 200; ++i) shard.insert(std::to_string(round * 100 + i));
+        s21::set<std::string> relay;
+        relay.merge(shard);
+        result.merge(relay);
+        result.erase(result.find(std::to_string(round * 100)));
+    }
+    EXPECT_EQ(result.size(), 397U);
+    result.insert("new");
+    s21::set<std::string> copy(result);
+    result.clear();
+    EXPECT_EQ(copy.size(), 398U);
+    EXPECT_TRUE(copy.contains("399"));
+}
+
+TEST(set, BulkBuildFromRange) {
+    std::vector<int> sorted(100000);
+    for (size_t i = 0; i < sorted.size(); ++i) sorted[i] = static_cast<int>(i) * 2;
+    SetProbe<int> my_set;
+    my_set.assign_sorted(sorted.begin(), sorted.end());
+    EXPECT_EQ(my_set.size(), sorted.size());
+    EXPECT_TRUE(my_set.IsBalanced());
+    // bottom-up build gives the minimal height
+    EXPECT_EQ(my_set.Height(), static_cast<int>(std::ceil(std::log2(sorted.size() + 1.0))));
+    EXPECT_TRUE(std::equal(my_set.begin(), my_set.end(), sorted.begin()));
+
+    std::vector<int> unsorted;
+    std::srand(12);
+    for (int i = 0; i < 5000; ++i) unsorted.push_back(std::rand() % 3000);
+    my_set.assign_sorted(unsorted.begin(), unsorted.end());
+    std::set<int> orig_set(unsorted.begin(), unsorted.end());
+    EXPECT_TRUE(my_set.IsBalanced());
+    EXPECT_EQ(my_set.size(), orig_set.size());
+    EXPECT_TRUE(std::equal(my_set.begin(), my_set.end(), orig_set.begin()));
+
+    std::istringstream words("b a c a");
+    s21::set<std::string> from_range{std::istream_iterator<std::string>(words), std::istream_iterator<std::string>()};
+    EXPECT_EQ(from_range.size(), 3U);
+    EXPECT_EQ(*from_range.begin(), "a");
+}
+
+TEST(set, BoundsMatchStdSet) {
+    s21::set<int> my_set;
+    std::set<int> orig_set;
+    std::srand(13);
+    for (int i = 0; i < 500; ++i) {
+        int value = std::rand() % 2000;
+        my_set.insert(value);
+        orig_set.insert(value);
+    }
+    for (int key = -5; key < 2005; ++key) {
+        auto lower = my_set.lower_bound(key);
+        auto upper = my_set.upper_bound(key);
+        auto orig_lower = orig_set.lower_bound(key);
+        auto orig_upper = orig_set.upper_bound(key);
+        ASSERT_EQ(lower == my_set.end(), orig_lower == orig_set.end());
+        ASSERT_EQ(upper == my_set.end(), orig_upper == orig_set.end());
+        if (orig_lower != orig_set.end()) {
+            ASSERT_EQ(*lower, *orig_lower);
+        }
+        if (orig_upper != orig_set.end()) {
+            ASSERT_EQ(*upper, *orig_upper);
+        }
+        auto range = my_set.equal_range(key);
+        ASSERT_EQ(std::distance(range.first, range.second), orig_set.count(key) ? 1 : 0);
+    }
+    auto last = my_set.upper_bound(*orig_set.rbegin());
+    --last;
+    EXPECT_EQ(*last, *orig_set.rbegin());
+}
+
+TEST(set, TransparentBounds) {
+    s21::set<std::string, std::less<>> my_set{"apple", "banana", "cherry"};
+    EXPECT_EQ(*my_set.lower_bound(std::string_view("b")), "banana");
+    EXPECT_EQ(*my_set.upper_bound(std::string_view("banana")), "cherry");
+    auto range = my_set.equal_range(std::string_view("cherry"));
+    EXPECT_EQ(*range.first, "cherry");
+    EXPECT_TRUE(range.second == my_set.end());
+}
+
+TEST(set, RangeEraseAndEraseIf) {
+    // a short range is erased node by node, a long one by rebuilding the tree
+    for (int width : {5, 600}) {
+        SetProbe<int> my_set;
+        std::set<int> orig_set;
+        for (int i = 0; i < 1000; ++i) {
+            my_set.insert(i);
+            orig_set.insert(i);
+        }
+        auto kept = my_set.find(999);
+        auto it = my_set.erase(my_set.lower_bound(100), my_set.lower_bound(100 + width));
+        orig_set.erase(orig_set.lower_bound(100), orig_set.lower_bound(100 + width));
+        EXPECT_EQ(*it, 100 + width);
+        EXPECT_EQ(*kept, 999);
+        EXPECT_TRUE(my_set.IsBalanced());
+        EXPECT_EQ(my_set.size(), orig_set.size());
+        EXPECT_TRUE(std::equal(my_set.begin(), my_set.end(), orig_set.begin()));
+    }
+
+    SetProbe<int> my_set;
+    for (int i = 0; i < 100; ++i) my_set.insert(i);
+    EXPECT_TRUE(my_set.erase(my_set.lower_bound(90), my_set.end()) == my_set.end());
+    EXPECT_EQ(my_set.size(), 90U);
+    EXPECT_EQ(s21::erase_if(my_set, [](int value) { return value % 3 != 0; }), 60U);
+    EXPECT_TRUE(my_set.IsBalanced());
+    EXPECT_EQ(my_set.size(), 30U);
+    EXPECT_EQ(*my_set.find_by_order(29), 87);
+    my_set.erase(my_set.begin(), my_set.end());
+    EXPECT_TRUE(my_set.empty());
+}
+
+TEST(set, SplitAndJoin) {
+    SetProbe<int> my_set;
+    for (int i = 0; i < 1000; ++i) my_set.insert(i * 2);
+    SetProbe<int> left;
+    SetProbe<int> right;
+    right.insert(-5);
+    EXPECT_TRUE(my_set.split(600, left, right));
+    EXPECT_EQ(my_set.size(), 1U);
+    EXPECT_EQ(*my_set.begin(), 600);
+    EXPECT_EQ(left.size(), 300U);
+    EXPECT_EQ(right.size(), 699U);
+    EXPECT_EQ(*left.find_by_order(299), 598);
+    EXPECT_EQ(*right.begin(), 602);
+    EXPECT_TRUE(left.IsBalanced());
+    EXPECT_TRUE(right.IsBalanced());
+    EXPECT_FALSE(right.split(603, left, my_set));
+    EXPECT_TRUE(right.empty());
+    EXPECT_EQ(left.size(), 1U);
+    EXPECT_EQ(my_set.size(), 698U);
+
+    // the parts are very different in height
+    SetProbe<int> joined;
+    joined.join(left, 603, my_set);
+    EXPECT_TRUE(left.empty());
+    EXPECT_TRUE(my_set.empty());
+    EXPECT_EQ(joined.size(), 700U);
+    EXPECT_TRUE(joined.IsBalanced());
+    EXPECT_EQ(*joined.find_by_order(1), 603);
+    EXPECT_EQ(joined.order_of_key(1998), 699U);
+    EXPECT_THROW(joined.join(left, 2000, joined), std::invalid_argument);
+    joined.join(left, -1, joined);
+    EXPECT_EQ(*joined.begin(), -1);
+    EXPECT_EQ(joined.size(), 701U);
+    EXPECT_TRUE(joined.IsBalanced());
+}
+
+TEST(set, SetAlgebraMatchesStdAlgorithms) {
+    std::srand(20);
+    for (int other_size : {0, 3, 100, 5000}) {
+        std::set<int> orig_big;
+        std::set<int> orig_small;
+        for (int i = 0; i < 5000; ++i) orig_big.insert(std::rand() % 20000);
+        for (int i = 0; i < other_size; ++i) orig_small.insert(std::rand() % 20000);
+        s21::set<int> big(orig_big.begin(), orig_big.end());
+        s21::set<int> small(orig_small.begin(), orig_small.end());
+        std::vector<int> expected;
+
+        SetProbe<int> result;
+        static_cast<s21::set<int> &>(result) = s21::set_intersection(small, big);
+        std::set_intersection(orig_small.begin(), orig_small.end(), orig_big.begin(), orig_big.end(),
+                              std::back_inserter(expected));
+        EXPECT_EQ(std::vector<int>(result.begin(), result.end()), expected);
+        EXPECT_TRUE(result.IsBalanced());
+        EXPECT_EQ(big.size(), orig_big.size());
+
+        expected.clear();
+        static_cast<s21::set<int> &>(result) = s21::set_difference(s21::set<int>(big), small);
+        std::set_difference(orig_big.begin(), orig_big.end(), orig_small.begin(), orig_small.end(),
+                            std::back_inserter(expected));
+        EXPECT_EQ(std::vector<int>(result.begin(), result.end()), expected);
+        EXPECT_TRUE(result.IsBalanced());
+        EXPECT_EQ(result.size(), expected.size());
+
+        expected.clear();
+        static_cast<s21::set<int> &>(result) = s21::set_difference(s21::set<int>(small), big);
+        std::set_difference(orig_small.begin(), orig_small.end(), orig_big.begin(), orig_big.end(),
+                            std::back_inserter(expected));
+        EXPECT_EQ(std::vector<int>(result.begin(), result.end()), expected);
+        EXPECT_TRUE(result.IsBalanced());
+
+        expected.clear();
+        static_cast<s21::set<int> &>(result) = s21::set_union(std::move(small), std::move(big));
+        std::set_union(orig_small.begin(), orig_small.end(), orig_big.begin(), orig_big.end(),
+                       std::back_inserter(expected));
+        EXPECT_EQ(std::vector<int>(result.begin(), result.end()), expected);
+        EXPECT_TRUE(result.IsBalanced());
+        EXPECT_EQ(result.size(), expected.size());
+        EXPECT_EQ(*result.find_by_order(result.size() / 2), expected[expected.size() / 2]);
+    }
+}
+
+TEST(set, SetAlgebraOnCopies) {
+    s21::set<std::string, std::less<>> lhs = {"a", "b", "c"};
+    s21::set<std::string, std::less<>> rhs = {"b", "c", "d"};
+    auto common = s21::set_intersection(rhs, lhs);
+    EXPECT_EQ(std::vector<std::string>(common.begin(), common.end()), std::vector<std::string>({"b", "c"}));
+    auto all = s21::set_union(decltype(lhs)(lhs), std::move(rhs));
+    EXPECT_EQ(all.size(), 4U);
+    EXPECT_EQ(lhs.size(), 3U); // lhs was copied
+    EXPECT_TRUE(rhs.empty()); // rhs gave its nodes away
+    auto rest = s21::set_difference(decltype(lhs)(lhs), lhs);
+    EXPECT_TRUE(rest.empty());
+}
+
+TEST(set, SetAlgebraReusesNodes) {
+    s21::set<int> big;
+    s21::set<int> small;
+    for (int i = 0; i < 1000; ++i) big.insert(2 * i);
+    for (int i = 0; i < 10; ++i) small.insert(100 * i + 1);
+    const int *big_key = &*big.find(500);
+    const int *small_key = &*small.find(301);
+    // узлы переходят в результат без копирования, поэтому адреса ключей не меняются
+    s21::set<int> all = s21::set_union(std::move(big), std::move(small));
+    EXPECT_TRUE(big.empty());
+    EXPECT_TRUE(small.empty());
+    EXPECT_EQ(all.size(), 1010U);
+    EXPECT_EQ(&*all.find(500), big_key);
+    EXPECT_EQ(&*all.find(301), small_key);
+
+    s21::set<int> odds;
+    for (int i = 0; i < 10; ++i) odds.insert(100 * i + 1);
+    s21::set<int> evens = s21::set_difference(std::move(all), odds);
+    EXPECT_TRUE(all.empty());
+    EXPECT_EQ(evens.size(), 1000U);
+    EXPECT_EQ(&*evens.find(500), big_key);
+    EXPECT_EQ(odds.size(), 10U);
+}
+
+TEST(set, FirstAndLastFollowBulkOperations) {
+    SetProbe<int> my_set;
+    for (int i = 1; i <= 100; ++i) my_set.insert(i);
+    SetProbe<int> left;
+    SetProbe<int> right;
+    my_set.split(40, left, right);
+    EXPECT_EQ(*std::prev(left.end()), 39);
+    EXPECT_EQ(*right.begin(), 41);
+    EXPECT_EQ(*std::prev(right.end()), 100);
+    EXPECT_EQ(*std::prev(my_set.end()), 40);
+
+    SetProbe<int> joined;
+    joined.join(left, 40, right);
+    EXPECT_TRUE(left.begin() == left.end());
+    EXPECT_TRUE(right.begin() == right.end());
+    EXPECT_EQ(*joined.begin(), 1);
+    EXPECT_EQ(*std::prev(joined.end()), 100);
+
+    s21::set<int> evens;
+    s21::set<int> odds;
+    for (int i = 0; i < 50; ++i) {
+        evens.insert(2 * i);
+        odds.insert(2 * i + 1);
+    }
+    s21::set<int> all = set_union(s21::set<int>(evens), s21::set<int>(odds));
+    EXPECT_EQ(*all.begin(), 0);
+    EXPECT_EQ(*std::prev(all.end()), 99);
+    s21::set<int> tail = set_difference(s21::set<int>(all), evens);
+    EXPECT_EQ(*tail.begin(), 1);
+    EXPECT_EQ(*std::prev(tail.end()), 99);
+
+    tail.swap(evens);
+    EXPECT_EQ(*std::prev(tail.end()), 98);
+    s21::set<int> moved(std::move(tail));
+    EXPECT_EQ(*std::prev(moved.end()), 98);
+    EXPECT_TRUE(tail.begin() == tail.end());
+}
+
+TEST(set, HintedInsertMatchesStdSet) {
+    SetProbe<int> my_set;
+    std::set<int> orig_set;
+    std::srand(22);
+    for (int i = 0; i < 3000; ++i) {
+        int key = std::rand() % 2000;
+        // подсказки разного качества: end(), соседний элемент, begin() и случайный элемент
+        auto hint = my_set.lower_bound(key);
+        if (i % 4 == 1) hint = my_set.end();
+        if (i % 4 == 2) hint = my_set.begin();
+        if (i % 4 == 3) hint = my_set.find_by_order(my_set.empty() ? 0 : std::rand() % my_set.size());
+        auto it = i % 2 == 0 ? my_set.insert(hint, key) : my_set.emplace_hint(hint, key);
+        orig_set.insert(key);
+        EXPECT_EQ(*it, key);
+    }
+    EXPECT_TRUE(my_set.IsBalanced());
+    EXPECT_EQ(my_set.size(), orig_set.size());
+    EXPECT_TRUE(std::equal(my_set.begin(), my_set.end(), orig_set.begin()));
+    EXPECT_EQ(*std::prev(my_set.end()), *orig_set.rbegin());
+
+    SetProbe<int> sorted;
+    for (int i = 0; i < 1000; ++i) sorted.insert(sorted.end(), i);
+    for (int i = 999; i >= 0; i -= 2) sorted.insert(sorted.begin(), i);
+    EXPECT_EQ(sorted.size(), 1000U);
+    EXPECT_TRUE(sorted.IsBalanced());
+    EXPECT_EQ(*sorted.begin(), 0);
+    EXPECT_EQ(*std::prev(sorted.end()), 999);
+}
+
+TEST(set, NodeHandleMovesBetweenSets) {
+    SetProbe<std::string> from;
+    SetProbe<std::string> to;
+    for (int i = 0; i < 200; ++i) from.insert(std::to_string(i));
+    const std::string *address = &*from.find("150");
+    for (int i = 0; i < 200; i += 2) {
+        auto result = to.insert(from.extract(std::to_string(i)));
+        EXPECT_TRUE(result.inserted);
+    }
+    EXPECT_EQ(from.size(), 100U);
+    EXPECT_EQ(to.size(), 100U);
+    EXPECT_EQ(&*to.find("150"), address);
+    EXPECT_TRUE(from.IsBalanced());
+    EXPECT_TRUE(to.IsBalanced());
+
+    // handle, который никуда не вставили, сам уничтожает узел
+    {
+        auto nh = from.extract(from.begin());
+        EXPECT_EQ(nh.value(), "1");
+        nh.value() += "!";
+        EXPECT_EQ(nh.key(), "1!");
+    }
+    EXPECT_EQ(from.size(), 99U);
+
+    // узлы из to, попавшие туда из from, переживают from
+    to.insert(from.extract("3"));
+    from.clear();
+    SetProbe<std::string> last;
+    last.insert(to.extract("3"));
+    to.clear();
+    EXPECT_EQ(*last.begin(), "3");
+    EXPECT_TRUE(last.insert(std::move(s21::set<std::string>::node_type())).position == last.end());
+}
@@ -0,0 +1,75 @@
+#include <cstdlib>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include "test_entry.h"
+
+namespace {
+    struct StringHash {
+        using is_transparent = void;
+        size_t operator()(std::string_view key) const { return std::hash<std::string_view>()(key); }
+    };
+}  // namespace
+
+TEST(unordered_map, InsertAndAccess) {
+    s21::unordered_map<int, std::string> my_map{{1, "one"}, {2, "two"}};
+    EXPECT_EQ(my_map.at(1), "one");
+    EXPECT_THROW(my_map.at(3), std::out_of_range);
+    my_map[3] = "three";
+    EXPECT_EQ(my_map.size(), 3U);
+    EXPECT_FALSE(my_map.insert(1, "uno").second);
+    EXPECT_FALSE(my_map.insert_or_assign(1, "uno").second);
+    EXPECT_EQ(my_map.at(1), "uno");
+    EXPECT_TRUE(my_map.emplace(4, "four").second);
+    EXPECT_FALSE(my_map.try_emplace(4, "cuatro").second);
+    EXPECT_EQ(my_map.find(4)->second, "four");
+    auto results = my_map.insert_many(std::make_pair(5, "five"), std::make_pair(0, "zero"));
+    EXPECT_EQ(results[0].first->second, "five");
+    EXPECT_EQ(results[1].first->second, "zero");
+    auto next = my_map.erase(my_map.find(0));
+    EXPECT_FALSE(my_map.contains(0));
+    EXPECT_TRUE(next == my_map.end() || my_map.contains(next->first));
+}
+
+TEST(unordered_map, RandomOperationsMatchStdUnorderedMap) {
+    s21::unordered_map<int, int> my_map;
+    std::unordered_map<int, int> orig_map;
+    std::srand(17);
+    for (int i = 0; i < 50000; ++i) {
+        int key = std::rand() % 5000;
+        switch (std::rand() % 3) {
+            case 0:
+                my_map[key] += i;
+                orig_map[key] += i;
+                break;
+            case 1:
+                EXPECT_EQ(my_map.insert(key, i).second, orig_map.insert({key, i}).second);
+                break;
+            default:
+                EXPECT_EQ(my_map.erase(key), orig_map.erase(key));
+        }
+    }
+    ASSERT_EQ(my_map.size(), orig_map.size());
+    for (const auto &item : orig_map) {
+        ASSERT_EQ(my_map.at(item.first), item.second);
+    }
+    size_t visited = 0;
+    for (auto it = my_map.begin(); it != my_map.end(); ++it) ++visited;
+    EXPECT_EQ(visited, orig_map.size());
+}
+
+TEST(unordered_map, TransparentLookupAndMerge) {
+    s21::unordered_map<std::string, int, StringHash, std::equal_to<>> my_map{{"a", 1}, {"b", 2}};
+    s21::unordered_map<std::string, int, StringHash, std::equal_to<>> other{{"b", 20}, {"c", 30}};
+    EXPECT_EQ(my_map.at(std::string_view("b")), 2);
+    EXPECT_TRUE(my_map.contains(std::string_view("a")));
+    my_map.merge(other);
+    EXPECT_EQ(my_map.size(), 3U);
+    EXPECT_EQ(my_map.at("b"), 2);
+    EXPECT_EQ(my_map.at("c"), 30);
+    EXPECT_EQ(other.size(), 1U);
+    EXPECT_EQ(other.at("b"), 20);
+    EXPECT_EQ(my_map.erase(std::string_view("a")), 1U);
+    EXPECT_EQ(my_map.size(), 2U);
+}
@@ -0,0 +1,111 @@
+#include <cstdlib>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+
+#include "test_entry.h"
+
+namespace {
+    // every key lands in the same group, so lookups have to probe through full groups and deleted slots
+    struct CollidingHash {
+        size_t operator()(int) const { return 42; }
+    };
+
+    struct StringHash {
+        using is_transparent = void;
+        size_t operator()(std::string_view key) const { return std::hash<std::string_view>()(key); }
+    };
+}  // namespace
+
+TEST(unordered_set, InsertFindErase) {
+    s21::unordered_set<int> my_set{5, 1, 3, 3};
+    EXPECT_EQ(my_set.size(), 3U);
+    EXPECT_TRUE(my_set.contains(3));
+    EXPECT_FALSE(my_set.contains(4));
+    EXPECT_EQ(*my_set.find(5), 5);
+    EXPECT_TRUE(my_set.find(4) == my_set.end());
+    EXPECT_EQ(my_set.erase(3), 1U);
+    EXPECT_EQ(my_set.erase(3), 0U);
+    auto results = my_set.insert_many(7, 1, 2);
+    EXPECT_TRUE(results[0].second);
+    EXPECT_FALSE(results[1].second);
+    EXPECT_EQ(*results[0].first, 7);
+    EXPECT_EQ(*results[2].first, 2);
+    EXPECT_EQ(std::distance(my_set.begin(), my_set.end()), 4);
+    s21::unordered_set<int> empty;
+    EXPECT_TRUE(empty.begin() == empty.end());
+    EXPECT_FALSE(empty.contains(1));
+    EXPECT_EQ(empty.erase(1), 0U);
+}
+
+TEST(unordered_set, RandomOperationsMatchStdUnorderedSet) {
+    s21::unordered_set<int> my_set;
+    std::unordered_set<int> orig_set;
+    std::srand(17);
+    for (int i = 0; i < 50000; ++i) {
+        int value = std::rand() % 3000;
+        if (std::rand() % 2 == 0) {
+            EXPECT_EQ(my_set.insert(value).second, orig_set.insert(value).second);
+        } else {
+            EXPECT_EQ(my_set.erase(value), orig_set.erase(value));
+        }
+    }
+    EXPECT_EQ(my_set.size(), orig_set.size());
+    EXPECT_LE(my_set.load_factor(), my_set.max_load_factor());
+    size_t visited = 0;
+    for (int value : my_set) {
+        EXPECT_EQ(orig_set.count(value), 1U);
+        ++visited;
+    }
+    EXPECT_EQ(visited, orig_set.size());
+}
+
+TEST(unordered_set, CollidingKeysProbeThroughGroups) {
+    s21::unordered_set<int, CollidingHash> my_set;
+    for (int i = 0; i < 200; ++i) my_set.insert(i);
+    for (int i = 0; i < 200; i += 2) my_set.erase(i);
+    for (int i = 0; i < 200; ++i) {
+        ASSERT_EQ(my_set.contains(i), i % 2 == 1);
+    }
+    for (int i = 200; i < 400; ++i) my_set.insert(i);
+    EXPECT_EQ(my_set.size(), 300U);
+    EXPECT_TRUE(my_set.contains(399));
+    EXPECT_FALSE(my_set.contains(0));
+}
+
+TEST(unordered_set, ReserveRehashAndTransparentLookup) {
+    s21::unordered_set<std::string, StringHash, std::equal_to<>> my_set;
+    my_set.reserve(1000);
+    size_t buckets = my_set.bucket_count();
+    EXPECT_GE(buckets * 7 / 8, 1000U);
+    for (int i = 0; i < 1000; ++i) my_set.insert(std::to_string(i));
+    EXPECT_EQ(my_set.bucket_count(), buckets);
+    EXPECT_TRUE(my_set.contains(std::string_view("999")));
+    EXPECT_TRUE(my_set.find(std::string_view("5")) != my_set.end());
+    EXPECT_EQ(my_set.erase(std::string_view("5")), 1U);
+    EXPECT_EQ(my_set.count("5"), 0U);
+    for (int i = 10; i < 1000; ++i) my_set.erase(std::to_string(i));
+    my_set.rehash(0);
+    EXPECT_LT(my_set.bucket_count(), buckets);
+    EXPECT_EQ(my_set.size(), 9U);
+    EXPECT_TRUE(my_set.contains("9"));
+}
+
+TEST(unordered_set, CopyMoveAndMerge) {
+    s21::unordered_set<std::string> my_set{"a", "b"};
+    s21::unordered_set<std::string> other{"b", "c"};
+    my_set.merge(other);
+    EXPECT_EQ(my_set.size(), 3U);
+    EXPECT_EQ(other.size(), 1U);
+    EXPECT_TRUE(other.contains("b"));
+
+    s21::unordered_set<std::string> copy(my_set);
+    s21::unordered_set<std::string> moved(std::move(my_set));
+    EXPECT_TRUE(my_set.empty());
+    EXPECT_EQ(moved.size(), 3U);
+    EXPECT_TRUE(copy.contains("c"));
+    other = copy;
+    copy.clear();
+    EXPECT_TRUE(copy.empty());
+    EXPECT_EQ(other.size(), 3U);
+}